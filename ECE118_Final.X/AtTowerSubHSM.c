@@ -32,35 +32,23 @@
 #include "BOARD.h"
 #include "RobotHSM.h"
 #include "AtTowerSubHSM.h"
+#include "hsm_engine.h"
 #include "TowerAlignSubHSM.h"
 #include "TowerTraverseSubHSM.h"
 #include "TowerShootSubHSM.h"
-#include "Robot.h"
+#include "robot.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
+#define TELEM_SOURCE TELEM_SRC_AtTowerSubHSM
+#include "telem_trace.h"
 #define TIMEOUT 20000
 #define STOPTIME 300000
+#define SHOOT_AFTER_CORNERS 2 //track wire only counts once more corners than this are behind us
 
-typedef enum {
-    InitPSubState,
-    Align,
-    Traverse,
-    Shoot,
-    LeavingTower,
-    Traverse_Scan,
-
-} AtTowerSubHSMState_t;
-
-static const char *StateNames[] = {
-	"InitPSubState",
-	"Align",
-	"Traverse",
-	"Shoot",
-	"LeavingTower",
-	"Traverse_Scan",
-};
+//states, StateNames[] and the transition tables come from AtTowerSubHSM.hsm
+#include "AtTowerSubHSM_table.h"
 
 
 
@@ -76,9 +64,7 @@ static const char *StateNames[] = {
 /* You will need MyPriority and the state variable; you may need others as well.
  * The type of state variable should match that of enum in header file. */
 
-static AtTowerSubHSMState_t CurrentState = InitPSubState; // <- change name to match ENUM
-static uint8_t MyPriority;
-static uint8_t trackwire_state = 0;
+static uint8_t CurrentState = InitPSubState; // <- change name to match ENUM
 int first_corner = 0; //0 means first corner not traversed, 1 means first corner traversedd
 /*******************************************************************************
  * PUBLIC FUNCTIONS                                                            *
@@ -121,156 +107,14 @@ uint8_t InitAtTowerSubHSM(void) {
  * @author J. Edward Carryer, 2011.10.23 19:25
  * @author Gabriel H Elkaim, 2011.10.23 19:25 */
 ES_Event RunAtTowerSubHSM(ES_Event ThisEvent) {
-    uint8_t makeTransition = FALSE; // use to flag transition
-    AtTowerSubHSMState_t nextState; // <- change type to correct enum
-
     ES_Tattle(); // trace call stack
 
-    switch (CurrentState) {
-        case InitPSubState: // If current state is initial Psedudo State
-            if (ThisEvent.EventType == ES_INIT)// only respond to ES_Init
-            {
-                // this is where you would put any actions associated with the
-                // transition from the initial pseudo-state into the actual
-                // initial state
-                // now put the machine into the actual initial state
-                nextState = Align;
-                makeTransition = TRUE;
-                ThisEvent.EventType = ES_NO_EVENT;
-            }
-            break;
-
-        case Align:
-            ThisEvent = RunTowerAlignSubHSM(ThisEvent);
-
-            switch (ThisEvent.EventType) {
-                case ES_ENTRY:
-                    ES_Timer_InitTimer(LOST_SERVICE_TIMER, TIMEOUT);
-                    break;
-
-                case ES_NO_EVENT:
-                    break;
-
-                case ES_EXIT:
-                    ES_Timer_InitTimer(LOST_SERVICE_TIMER, STOPTIME);
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    break;
-
-                case BOT_ALIGNED:
-                    nextState = Traverse;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    ResetTowerAlignSubHSM();
-                    break;
-
-                default: // all unhandled states fall into here
-                    break;
-            }
-            break;
-
-        case Traverse:
-            ThisEvent = RunTowerTraverseSubHSM(ThisEvent);
-
-            switch (ThisEvent.EventType) {
-                case ES_ENTRY:
-                    ES_Timer_InitTimer(LOST_SERVICE_TIMER, TIMEOUT);
-                    break;
-
-                case ES_NO_EVENT:
-                    break;
-                    
-                case ES_EXIT:
-                    ES_Timer_InitTimer(LOST_SERVICE_TIMER, STOPTIME);
-                    first_corner = 0;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    break;
-
-                case CORNER_TRAVERSED:
-                    first_corner++;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    break;
-
-                case TRACK_WIRE_CHANGED:
-                    //unsure if should bother stopping here
-                    if (first_corner > 2) {
-                        nextState = Shoot;
-                        makeTransition = TRUE;
-                        PostRobotHSM(ThisEvent); //todo: see if this is a valid way to repost event. Check for tape as well
-                        first_corner = 0;
-                        ResetTowerTraverseSubHSM();
-                    }
-                    ThisEvent.EventType = ES_NO_EVENT;
-
-                    break;
-
-                default:
-                    break;
-            }
-            break;
-
-        case Shoot:
-
-            ThisEvent = RunTowerShootSubHSM(ThisEvent);
-
-            switch (ThisEvent.EventType) {
-                case ES_ENTRY:
-                    ES_Timer_InitTimer(LOST_SERVICE_TIMER, TIMEOUT);
-                    break;
-                case ES_NO_EVENT:
-                    break;
-
-                    //                case BALL_DEPOSITED:
-                    //                    Robot_LeftMtrSpeed(100);
-                    //                    Robot_RightMtrSpeed(100);
-                    //                    nextState = LeavingTower;
-                    //                    makeTransition = TRUE;
-                    //                    ThisEvent.EventType = ES_NO_EVENT;
-                    //                    ResetTowerShootSubHSM();
-                    //
-                    //                    break;
-
-                case ES_EXIT:
-                    ES_Timer_InitTimer(LOST_SERVICE_TIMER, STOPTIME);
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    break;
-
-                default:
-                    break;
-            }
-            break;
-
-        case LeavingTower:
-            switch (ThisEvent.EventType) {
-                case ES_NO_EVENT:
-                    break;
-
-                case ES_EXIT:
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    break;
-
-                default:
-                    break;
-            }
-            break;
-        default: // all unhandled states fall into here
-            break;
-    }
-
-    if (makeTransition == TRUE) { // making a state transition, send EXIT and ENTRY
-        // recursively call the current state with an exit event
-        RunAtTowerSubHSM(EXIT_EVENT); // <- rename to your own Run function
-        CurrentState = nextState;
-        RunAtTowerSubHSM(ENTRY_EVENT); // <- rename to your own Run function
-    }
+    HSM_Dispatch(&AtTowerSubHSMMachine, &CurrentState, &ThisEvent);
 
     ES_Tail(); // trace call stack end
     return ThisEvent;
-
 }
 
-void incrementCornerCount(void);
-int getcornerCount(void);
-
 //reset SM to desired init state upon exiting in top level (to renter this SM next time in correct init state)
 
 int ResetAtTowerSubHSM(void) {
@@ -284,7 +128,49 @@ int ResetAtTowerSubHSM(void) {
     first_corner = 0;
     return 1;
 }
+
+uint8_t QueryAtTowerSubHSM(void) {
+    return CurrentState;
+}
 /*******************************************************************************
  * PRIVATE FUNCTIONS                                                           *
  ******************************************************************************/
 
+//guards
+
+static uint8_t PastCorners(const ES_Event *ThisEvent) {
+    return (first_corner > SHOOT_AFTER_CORNERS);
+}
+
+//actions
+
+static void FinishAlign(ES_Event *ThisEvent) {
+    ResetTowerAlignSubHSM();
+}
+
+static void CountCorner(ES_Event *ThisEvent) {
+    first_corner++;
+}
+
+static void StartShoot(ES_Event *ThisEvent) {
+    //unsure if should bother stopping here
+    HSM_Recall(*ThisEvent); //Shoot sees the track wire event once it is entered
+    first_corner = 0;
+    ResetTowerTraverseSubHSM();
+}
+
+//entry/exit hooks, the lost timer runs while we work on the tower and is
+//pushed out of the way once a state is done
+
+static void ArmLostTimer(void) {
+    ES_Timer_InitTimer(LOST_SERVICE_TIMER, TIMEOUT);
+}
+
+static void StopLostTimer(void) {
+    ES_Timer_InitTimer(LOST_SERVICE_TIMER, STOPTIME);
+}
+
+static void TraverseExit(void) {
+    StopLostTimer();
+    first_corner = 0;
+}
@@ -73,3 +73,6 @@ ES_Event RunAtTowerSubHSM(ES_Event ThisEvent);
 #endif /* SUB_HSM_Template_H */
 
 int ResetAtTowerSubHSM(void);
+
+//current state, for the RobotHSM event trace (event_trace.h)
+uint8_t QueryAtTowerSubHSM(void);
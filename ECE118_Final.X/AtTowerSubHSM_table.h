@@ -0,0 +1,62 @@
+/*
+ * File:   AtTowerSubHSM_table.h
+ *
+ * Generated by host/hsm_gen from AtTowerSubHSM.hsm, edit the spec and run "make hsm"
+ * in host/ instead of editing this file. Included once, by AtTowerSubHSM.c.
+ */
+
+#ifndef ATTOWERSUBHSM_TABLE_H
+#define ATTOWERSUBHSM_TABLE_H
+
+#include <stddef.h>
+#include "hsm_engine.h"
+
+typedef enum {
+    InitPSubState,
+    Align,
+    Traverse,
+    Shoot,
+    ATTOWERSUBHSM_NUM_STATES,
+} AtTowerSubHSMState_t;
+
+static const char *StateNames[] = {
+    "InitPSubState",
+    "Align",
+    "Traverse",
+    "Shoot",
+};
+
+//guards, actions and hooks, defined in AtTowerSubHSM.c
+static uint8_t PastCorners(const ES_Event *ThisEvent);
+static void FinishAlign(ES_Event *ThisEvent);
+static void CountCorner(ES_Event *ThisEvent);
+static void StartShoot(ES_Event *ThisEvent);
+static void ArmLostTimer(void);
+static void StopLostTimer(void);
+static void TraverseExit(void);
+
+static const HSM_State_t AtTowerSubHSMStates[ATTOWERSUBHSM_NUM_STATES] = {
+    [InitPSubState] = {NULL, NULL, NULL, NULL},
+    [Align] = {ArmLostTimer, StopLostTimer, RunTowerAlignSubHSM, NULL},
+    [Traverse] = {ArmLostTimer, TraverseExit, RunTowerTraverseSubHSM, NULL},
+    [Shoot] = {ArmLostTimer, StopLostTimer, RunTowerShootSubHSM, NULL},
+};
+
+static const HSM_Transition_t AtTowerSubHSMTransitions[] = {
+    {NULL, NULL, Align}, //InitPSubState ES_INIT
+    {NULL, FinishAlign, Traverse}, //Align BOT_ALIGNED
+    {NULL, CountCorner, HSM_NO_STATE}, //Traverse CORNER_TRAVERSED
+    {PastCorners, StartShoot, Shoot}, //Traverse TRACK_WIRE_CHANGED
+    {NULL, NULL, HSM_NO_STATE}, //Traverse TRACK_WIRE_CHANGED
+};
+
+static const HSM_Slot_t AtTowerSubHSMSlots[ATTOWERSUBHSM_NUM_STATES][NUMBEROFEVENTS] = {
+    [InitPSubState][ES_INIT] = {0, 1},
+    [Align][BOT_ALIGNED] = {1, 1},
+    [Traverse][CORNER_TRAVERSED] = {2, 1},
+    [Traverse][TRACK_WIRE_CHANGED] = {3, 2},
+};
+
+static const HSM_Machine_t AtTowerSubHSMMachine = {AtTowerSubHSMStates, &AtTowerSubHSMSlots[0][0], AtTowerSubHSMTransitions};
+
+#endif /* ATTOWERSUBHSM_TABLE_H */
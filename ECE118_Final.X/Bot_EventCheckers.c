@@ -30,29 +30,37 @@
 #include "Bot_EventCheckers.h"
 #include "ES_Events.h"
 #include "serial.h"
-#include "AD.h"
 #include "robot.h"
+#include "robot_hal.h"
+#include "beacon_goertzel.h"
+#include "fixed_math.h"
+#include <stdlib.h>
 #include "stdio.h"
 #include "RobotHSM.h"
 #include "ES_Timers.h"
+#include "tape_filter.h"
+#include "trackwire_cal.h"
+#include "telemetry.h"
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
 #define BATTERY_DISCONNECT_THRESHOLD 175
-#define UPPER_BEACON_BOUND 820
-#define LOWER_BEACON_BOUND 720
-#define BEACON_NUM_SAMPLES 200
-#define TRACKWIRE_NUM_SAMPLES 20
-#define TRACKWIRE_DEBUG_PRINT 0 //set to 1 to print each calculated trackwire avg. Do with high
-                                //trackwire switch time or you will spam print.
-#define TRACKWIRE_SWITCH_TIME 10 //time in ms between switching (and reading) trackwire sensors
-                                //set to 2 for nromal operation. Set to 500 when debugging 
-                                //if setting print trackwrire values to true
-
-
-//TRACK WIRE
-#define UPPER_TRACKWIRE_BOUND 580
-#define LOWER_TRACKWIRE_BOUND 540
+#define BEACON_NUM_DETECTORS 3
+#define BEACON_NOISE_AMPLITUDE 10 //tone amplitude with no beacon, taken off before the bearing math
+#define BEACON_BEARING_MIN_SUM 40 //summed amplitude needed for a bearing
+#define BEACON_BEARING_DEADBAND DEG_TO_ANGLE(5) //repost BEACON_BEARING after it moves this much
+#define BEACON_UPPER_AMPLITUDE2 ((uint32_t) BEACON_UPPER_AMPLITUDE * BEACON_UPPER_AMPLITUDE) //see beacon_goertzel.h
+#define BEACON_LOWER_AMPLITUDE2 ((uint32_t) BEACON_LOWER_AMPLITUDE * BEACON_LOWER_AMPLITUDE)
+#if (BEACON_BLOCK_LEN % HAL_ADC_BLOCK_LEN) != 0
+#error "BEACON_BLOCK_LEN has to be a whole number of scan blocks"
+#endif
+#define TRACKWIRE_SWITCH_TIME 10 //settle time in ms after switching trackwire sensors, the
+                                //blocks from before it are skipped
+
+#define TRACKWIRE_TELEM_STEP 4 //send the band again once either bound moved this far
+#if (TRACKWIRE_SWITCH_TIME * (HAL_ADC_SCAN_HZ / 1000) / HAL_ADC_BLOCK_LEN + TW_CAL_MAX_BLOCKS) >= TW_CAL_FRESH_BLOCKS
+#error "a decision of one track wire sensor has to be fresh when the other one is decided after a switch"
+#endif
 /*******************************************************************************
  * EVENTCHECKER_TEST SPECIFIC CODE                                                             *
  ******************************************************************************/
@@ -70,6 +78,9 @@ static ES_Event storedEvent;
  ******************************************************************************/
 /* Prototypes for private functions for this EventChecker. They should be functions
    relevant to the behavior of this particular event checker */
+static uint8_t BeaconBearing(const uint32_t *amplitude2, int16_t *bearing);
+static uint32_t FirstSettledBlock(uint16_t settle_scans);
+static void TrackWire_SendBand(uint8_t sensor);
 
 /*******************************************************************************
  * PRIVATE MODULE VARIABLES                                                    *
@@ -78,16 +89,17 @@ static ES_Event storedEvent;
 /* Any private module level variable that you might need for keeping track of
    events would be placed here. Private variables should be STATIC so that they
    are limited in scope to this module. */
-enum encoder_states {
-    state_0_0, state_0_1, state_1_0, state_1_1
-};
 
-enum encoder_steps {
-    enc_no_step, enc_increment, enc_decrement
+//beacon scan, indexed by detector (0 = left, 1 = front, 2 = right)
+static uint8_t beacon_scan_mode = BEACON_SCAN_FRONT;
+static const int16_t BeaconAngles[BEACON_NUM_DETECTORS] = {
+    DEG_TO_ANGLE(LEFT_BEACON_OFFSET_DEG), DEG_TO_ANGLE(FRONT_BEACON_OFFSET_DEG), DEG_TO_ANGLE(RIGHT_BEACON_OFFSET_DEG)
 };
-int left_encoder_state = state_0_0;
-int32_t left_last_count = 0;
-int test_bool = 0;
+static const uint8_t BeaconSettleSamples[BEACON_NUM_DETECTORS] = {20, 20, 20}; //2 ms at HAL_ADC_SCAN_HZ
+
+static TapeFilter_t tape_filter; //all zero is all sensors off
+static TrackWireCal_t trackwire_cal; //all zero is uncalibrated
+static uint16_t trackwire_sent[TW_CAL_SENSORS][2]; //band last sent on the telemetry stream
 /*******************************************************************************
  * PUBLIC FUNCTIONS                                                            *
  ******************************************************************************/
@@ -111,7 +123,7 @@ uint8_t CheckBattery(void) {
     ES_EventTyp_t curEvent;
     ES_Event thisEvent;
     uint8_t returnVal = FALSE;
-    uint16_t batVoltage = AD_ReadADPin(BAT_VOLTAGE); // read the battery voltage
+    uint16_t batVoltage = Robot_BatteryVoltage(); // read the battery voltage
 
     if (batVoltage > BATTERY_DISCONNECT_THRESHOLD) { // is battery connected?
         curEvent = BATTERY_CONNECTED;
@@ -125,7 +137,6 @@ uint8_t CheckBattery(void) {
         returnVal = TRUE;
         lastEvent = curEvent; // update history
         //printf("Battery Change: 0x%X\n", batVoltage);
-        //printf("testbool: %d   ", test_bool);
 #ifndef EVENTCHECKER_TEST           // keep this as is for test harness
         //PostGenericService(thisEvent);
         PostRobotHSM(thisEvent);
@@ -136,15 +147,25 @@ uint8_t CheckBattery(void) {
     return (returnVal);
 }
 
+//each sensor goes through the N-of-M filter in tape_filter.c, sampled once a
+//ms so the window does not depend on how fast the event loop spins
 uint8_t CheckTape(void) {
     static uint16_t prevTape = 0x00;
+    static uint32_t lastSampleTime = 0;
 
     ES_EventTyp_t curEvent;
     ES_Event thisEvent;
     uint8_t returnVal = FALSE;
-    uint16_t currentTape = Robot_ReadTape(); // read the battery voltage
+    uint16_t currentTape;
+    uint32_t now = ES_Timer_GetTime();
+
+    if (now == lastSampleTime) {
+        return (returnVal);
+    }
+    lastSampleTime = now;
+    currentTape = TapeFilter_Sample(&tape_filter, Robot_ReadTape());
 
-    if (currentTape != prevTape) { // is battery connected?
+    if (currentTape != prevTape) {
         prevTape = currentTape;
         curEvent = TAPE_CHANGED;
         thisEvent.EventType = curEvent;
@@ -162,350 +183,281 @@ uint8_t CheckTape(void) {
     return (returnVal);
 }
 
-//uint8_t CheckBumper(void) {
-//    static uint16_t prevBumper_state = 0xFF;
-//    ES_EventTyp_t curEvent;
-//    ES_Event thisEvent;
-//    uint8_t returnVal = FALSE;
-//    uint16_t newBumper_state = Robot_ReadBumpers(); // read the battery voltage
-//
-//    if (newBumper_state != prevBumper_state) { // is battery connected?
-//        curEvent = BUMPERS_CHANGED;
-//        thisEvent.EventType = curEvent;
-//        thisEvent.EventParam = newBumper_state;
-//        returnVal = TRUE;
-//        prevBumper_state = newBumper_state;
-//        printf("BUMPER_CHANGED: 0x%X\n", newBumper_state);
-//
-//#ifndef EVENTCHECKER_TEST           // keep this as is for test harness
-//        //PostGenericService(thisEvent);
-//        PostRobotHSM(thisEvent);
-//
-//#else
-//        SaveEvent(thisEvent);
-//#endif   
-//    }
-//    return (returnVal);
-//}
-
-uint8_t CheckBeacon(void) {
-    static uint32_t sample_sum = 0;
-    static uint32_t start_time = 0;
-    static uint8_t sample_count = 0;
-    static uint8_t wait = 0;
-    static uint8_t beacon_state[] = {0, 0, 0};
-
-    //beacon (from services))
-    static uint8_t * beacon_active = &beacon_state[1]; //pointer to currently active beacon detector's variable
-    static uint8_t beacon_select = 1;
+void Tape_PrintFilterStats(void) {
+    printf("TAPE filter %d of %d ms: raw edges %lu, passed %lu, glitches suppressed %lu\n",
+            TAPE_FILTER_N, TAPE_FILTER_M, (unsigned long) tape_filter.raw_edges,
+            (unsigned long) tape_filter.edges, (unsigned long) TapeFilter_Suppressed(&tape_filter));
+}
 
-    ES_EventTyp_t curEvent;
+//the debouncing is done in Robot_TickISR (robot.c), this only posts the changes
+uint8_t CheckBumper(void) {
+    static uint8_t prevBumper_state = 0;
     ES_Event thisEvent;
     uint8_t returnVal = FALSE;
-    uint16_t sample_avg = 0;
-    if (wait) {
+    uint8_t newBumper_state = Robot_GetBumpers();
 
-        if ((ES_Timer_GetTime() - start_time) > 2) { //wait at least 1 ms after switching beacon
-            wait = 0;
-
-        }
-    } else {
-
-        //take next sample if goal not reached
-        if (sample_count < BEACON_NUM_SAMPLES) {
-            sample_sum += AD_ReadADPin(BEACON_ADC);
-            sample_count++;
-        }//update beacon state based on avg and switch beacons
-        else {
-
-            //calculate avg and update state
-            sample_avg = sample_sum / BEACON_NUM_SAMPLES;
-            //printf("   avg: %d       \n", sample_avg);
-
-            //if beacon detector low on last read && current reading above high threshold 
-            if ((0 == (*beacon_active)) && (sample_avg > UPPER_BEACON_BOUND)) {
-                *beacon_active = 1;
-                curEvent = BEACON_CHANGED;
-
-                //if beacon detector high on last read && current reading below low threshold
-            } else if ((*beacon_active) && (sample_avg < LOWER_BEACON_BOUND)) {
-                *beacon_active = 0;
-                curEvent = BEACON_CHANGED;
-            }
-
-            //post event if beacon detection state changed
-            if (BEACON_CHANGED == curEvent) {
-                returnVal = TRUE;
-
-                thisEvent.EventType = curEvent;
-                thisEvent.EventParam = ((beacon_state[0] << 2) | (beacon_state[1] << 1) | beacon_state[2]);
+    if (newBumper_state != prevBumper_state) {
+        thisEvent.EventType = BUMPERS_CHANGED;
+        thisEvent.EventParam = newBumper_state;
+        returnVal = TRUE;
+        prevBumper_state = newBumper_state;
 
 #ifndef EVENTCHECKER_TEST           // keep this as is for test harness
-                PostRobotHSM(thisEvent);
+        PostRobotHSM(thisEvent);
 #else
-                SaveEvent(thisEvent);
-#endif  
-
-            }
-
-            //switch active beacon
-            //beacon_select = (beacon_select + 1) % 3; //loop through 0, 1, 2
-            beacon_active = &beacon_state[beacon_select];
-            BEACON_LATA = (0 == beacon_select);
-            BEACON_LATB = (1 == beacon_select);
-            BEACON_LATC = (2 == beacon_select);
-
-            //set values
-            start_time = ES_Timer_GetTime();
-            wait = 1;
-            sample_count = 0;
-            sample_sum = 0;
-
-            //printf("beacon ec done");
-
-        }
+        SaveEvent(thisEvent);
+#endif   
     }
     return (returnVal);
 }
 
-uint8_t CheckTrackWire(void) {
-    static uint32_t sample_sum = 0;
-    static uint32_t start_time = 0;
-    static uint8_t sample_count = 0;
-    static uint8_t wait = 0;
-    static uint8_t trackwire_state[] = {0, 0};
+void Beacon_SetScanMode(uint8_t mode) {
+    beacon_scan_mode = mode;
+}
 
-    //beacon (from services))
-    static uint8_t * trackwire_active = &trackwire_state[0]; //pointer to currently active trackwire detector's variable
-    static uint8_t trackwire_select = 0;
+uint8_t CheckBeacon(void) {
+    static int16_t beacon_buf[BEACON_BLOCK_LEN];
+    static uint32_t amplitude2[BEACON_NUM_DETECTORS];
+    static uint32_t next_block = 0; //scan block that goes into beacon_buf next
+    static uint8_t have = 0; //samples in beacon_buf
+    static uint8_t beacon_state = 0; //*_BEACON_MASK bits of the detectors that see the tone
+    static uint8_t beacon_select = 1; //0 = left, 1 = front, 2 = right
+    static uint8_t selected = FALSE;
+    static uint8_t bearing_valid = 0;
+    static int16_t last_bearing = 0;
 
-    ES_EventTyp_t curEvent;
     ES_Event thisEvent;
     uint8_t returnVal = FALSE;
-    uint16_t sample_avg = 0;
-    if (wait) {
-
-        //TODO- SET VALUE TO 2 NOT 500 DURING NORMAL OP
-        if ((ES_Timer_GetTime() - start_time) > TRACKWIRE_SWITCH_TIME) { //wait at least 1 ms after switching trackwire
-            wait = 0;
-        }
-    } else {
-
-        //take next sample if goal not reached
-        if (sample_count < TRACKWIRE_NUM_SAMPLES) {
-            sample_sum += AD_ReadADPin(TRACK_WIRE_ADC);
-            sample_count++;
-        }//update beacon state based on avg and switch beacons
-        else {
- 
-            //calculate avg and update state
-            sample_avg = sample_sum / TRACKWIRE_NUM_SAMPLES;
-            if(TRACKWIRE_DEBUG_PRINT){
-            printf("t%d: %d       \n", trackwire_select, sample_avg);
-            }
-            if ((!(*trackwire_active)) && (sample_avg > UPPER_TRACKWIRE_BOUND)) {
-                *trackwire_active = 1;
-
-                //post event indicating trackwire found if both track wire sensors are now detecting
-                if (trackwire_state[0] && trackwire_state[1]) {
-                    returnVal = TRUE;
-                    thisEvent.EventParam = 1; //trackwire found
-
-                    thisEvent.EventType = TRACK_WIRE_CHANGED;
-                }
+    uint8_t mask = (1 << beacon_select);
+    uint8_t prev_state = beacon_state;
+    uint8_t next_select;
+    int16_t bearing;
+
+    //the detector is sampled in the background at HAL_ADC_SCAN_HZ, a Goertzel
+    //block is put together from consecutive scan blocks. After a detector
+    //switch the blocks that overlap the settle time are skipped, so the settle
+    //time is exact and costs no polling here
+    if (!selected) {
+        Robot_SelectBeacon(beacon_select);
+        next_block = FirstSettledBlock(BeaconSettleSamples[beacon_select]);
+        selected = TRUE;
+    }
+    switch (Robot_ReadAdcBlock(HAL_BEACON_ADC, next_block, &beacon_buf[have])) {
+        case ROBOT_ADC_READ:
+            next_block++;
+            have += HAL_ADC_BLOCK_LEN;
+            break;
+        case ROBOT_ADC_MISSED:
+            //fell behind, start over on the block being filled
+            next_block = Robot_AdcScans() / HAL_ADC_BLOCK_LEN;
+            have = 0;
+            return FALSE;
+        default:
+            return FALSE;
+    }
+    if (have < BEACON_BLOCK_LEN) {
+        return FALSE;
+    }
+    have = 0;
 
-            } else if ((*trackwire_active) && (sample_avg < LOWER_TRACKWIRE_BOUND)) {
-                //trackwire is considered lost both sensors were detecting before (so either sensor is now no longer detecting)
-                if ((trackwire_state[0] && trackwire_state[1])) { //checking last state of track wire
-                    returnVal = TRUE;
+    amplitude2[beacon_select] = Goertzel_Amplitude2(beacon_buf, BEACON_BLOCK_LEN, BEACON_GOERTZEL_COEFF);
 
-                    thisEvent.EventType = TRACK_WIRE_CHANGED;
-                    thisEvent.EventParam = 0; //trackwire lost
+    //if detector low on last block && tone now above high threshold, or
+    //detector high on last block && tone now below low threshold
+    if (!(beacon_state & mask) && (amplitude2[beacon_select] > BEACON_UPPER_AMPLITUDE2)) {
+        beacon_state |= mask;
+    } else if ((beacon_state & mask) && (amplitude2[beacon_select] < BEACON_LOWER_AMPLITUDE2)) {
+        beacon_state &= ~mask;
+    }
+    if (BEACON_SCAN_FRONT == beacon_scan_mode) {
+        beacon_state &= FRONT_BEACON_MASK; //side detectors are not being read
+    }
 
-                }
+    //post event if beacon detection state changed
+    if (beacon_state != prev_state) {
+        returnVal = TRUE;
+        thisEvent.EventType = BEACON_CHANGED;
+        thisEvent.EventParam = beacon_state;
 
-                //update state of active trackwire
-                *trackwire_active = 0;
-            }
-            //post event if beacon detection state changed
+#ifndef EVENTCHECKER_TEST           // keep this as is for test harness
+        PostRobotHSM(thisEvent);
+#else
+        SaveEvent(thisEvent);
+#endif  
+    }
 
-            if (TRACK_WIRE_CHANGED == thisEvent.EventType) {
+    //pick the next detector, a full left-front-right round updates the bearing
+    if (BEACON_SCAN_ALL == beacon_scan_mode) {
+        if ((BEACON_NUM_DETECTORS - 1) == beacon_select) {
+            if (BeaconBearing(amplitude2, &bearing)) {
+                if (!bearing_valid || (abs(bearing - last_bearing) > BEACON_BEARING_DEADBAND)) {
+                    bearing_valid = 1;
+                    last_bearing = bearing;
                     returnVal = TRUE;
+                    thisEvent.EventType = BEACON_BEARING;
+                    thisEvent.EventParam = (uint16_t) bearing;
 
 #ifndef EVENTCHECKER_TEST           // keep this as is for test harness
                     PostRobotHSM(thisEvent);
 #else
                     SaveEvent(thisEvent);
 #endif  
-
                 }
-
-            //switch active beacon
-            trackwire_select = !trackwire_select; //switch between 1 and 0
-            trackwire_active = &trackwire_state[trackwire_select];
-            TRACK_WIRE_LATA = trackwire_select;
-            TRACK_WIRE_LATB = !trackwire_select;
-            //set values
-            start_time = ES_Timer_GetTime();
-            wait = 1;
-            sample_count = 0;
-            sample_sum = 0;
-
-            //printf("beacon ec done");
-
+            } else {
+                bearing_valid = 0;
+            }
         }
+        next_select = (beacon_select + 1) % BEACON_NUM_DETECTORS; //loop through 0, 1, 2
+    } else {
+        next_select = 1;
+        bearing_valid = 0;
+    }
+
+    //settle scheduler, only pay the settle time when the detector changes
+    if (next_select != beacon_select) {
+        beacon_select = next_select;
+        Robot_SelectBeacon(beacon_select);
+        next_block = FirstSettledBlock(BeaconSettleSamples[beacon_select]);
     }
     return (returnVal);
 }
 
-//Encoder code reused from Aram's ECE 167 encoder lab
-//This function tracks the steps of the encoder, and appropriately increments 
-// or decrements the encounter step count held in the robot.c module (the step
-// count must be accessible with getter functions in the robot.c module. Keeping 
-// count in this module and setting the value in the robot.c module every step 
-// would be much more expensive due to the large variable size)
-
-uint8_t CheckLeftEncoder(void) {
-    static uint16_t left_encoder_state = 0x0;
-    //ES_EventTyp_t curEvent;
-    //ES_Event thisEvent;
-    int8_t returnVal = FALSE;
-
-
-    int A = MTR_A_ENCA_BIT;
-    int B = MTR_A_ENCB_BIT;
-
-    //SM Code
-    int left_new_state = (A << 1) + B;
-    int left_encoder_step = enc_no_step; //no step by default
-    if (left_new_state != left_encoder_state) {
-        switch (left_encoder_state) {
-            case state_0_0:
-                //cw
-                if (left_new_state == state_1_0) {
-                    left_encoder_step = enc_increment;
-                }//ccw
-                else if (left_new_state == state_0_1) {
-                    left_encoder_step = enc_decrement;
-                }
-                break;
-            case state_1_0:
-                //cw
-                if (left_new_state == state_1_1) {
-                    left_encoder_step = enc_increment;
-                }//ccw
-                else if (left_new_state == state_0_0) {
-                    left_encoder_step = enc_decrement;
-                }
-                break;
-            case state_1_1:
-                //cw
-                if (left_new_state == state_0_1) {
-                    left_encoder_step = enc_increment;
-                }//ccw
-                else if (left_new_state == state_1_0) {
-                    left_encoder_step = enc_decrement;
-                }
-                break;
-
-            case state_0_1:
-                //cw
-                if (left_new_state == state_0_0) {
-                    left_encoder_step = enc_increment;
-                }//ccw
-                else if (left_new_state == state_1_1) {
-                    left_encoder_step = enc_decrement;
-                }
-                break;
-        }
+uint8_t CheckTrackWire(void) {
+    static uint32_t next_block = 0; //scan block of the selected sensor to read next
 
-        //update state
-        left_encoder_state = left_new_state;
+    ES_Event thisEvent;
+    uint8_t returnVal = FALSE;
+    uint8_t select = trackwire_cal.select;
+    int32_t sample_sum = 0;
+    uint16_t sample_avg;
+    int16_t block[HAL_ADC_BLOCK_LEN];
+    uint8_t i;
+
+    //take the next block, the sensor is sampled in the background and the
+    //blocks from before the settle time are never asked for
+    switch (Robot_ReadAdcBlock(HAL_TRACK_WIRE_ADC, next_block, block)) {
+        case ROBOT_ADC_READ:
+            for (i = 0; i < HAL_ADC_BLOCK_LEN; i++) {
+                sample_sum += block[i];
+            }
+            break;
+        case ROBOT_ADC_MISSED:
+            //fell behind, go on with the block being filled, the readings of
+            //the sequential test do not have to be back to back
+            next_block = Robot_AdcScans() / HAL_ADC_BLOCK_LEN;
+            return FALSE;
+        default:
+            return FALSE;
+    }
 
-        //update robot.c count
-        if (enc_increment == left_encoder_step) {
-            Robot_IncrementLeftEnc();
-        } else if (enc_decrement == left_encoder_step) {
-            Robot_DecrementLeftEnc();
+    sample_avg = sample_sum / HAL_ADC_BLOCK_LEN;
+    //posts once both sensors agree the wire is there (param 1), and once
+    //either one stops seeing it (param 0)
+    if (TrackWireCal_Block(&trackwire_cal, sample_avg, next_block)) {
+        returnVal = TRUE;
+        thisEvent.EventType = TRACK_WIRE_CHANGED;
+        thisEvent.EventParam = trackwire_cal.found;
 
-        }
+#ifndef EVENTCHECKER_TEST           // keep this as is for test harness
+        PostRobotHSM(thisEvent);
+#else
+        SaveEvent(thisEvent);
+#endif  
+    }
+    TrackWire_SendBand(select);
+    next_block++;
 
-        //        if (abs(encoder_count - last_count) > 10) {
-        //            printf("state:%d count:%d\n", encoder_state, encoder_count);
-        //            last_count = encoder_count;
-        //        }
+    //switch detectors only when the sequential test asks for the other one
+    if (trackwire_cal.select != select) {
+        Robot_SelectTrackWire(trackwire_cal.select);
+        next_block = FirstSettledBlock(TRACKWIRE_SWITCH_TIME * (HAL_ADC_SCAN_HZ / 1000));
     }
     return (returnVal);
+}
 
+void TrackWire_GetBand(uint8_t sensor, uint16_t *lower, uint16_t *upper) {
+    TrackWireCal_GetBand(&trackwire_cal, sensor, lower, upper);
 }
 
-uint8_t CheckRightEncoder(void) {
-    static uint16_t right_encoder_state = 0x0;
-    //ES_EventTyp_t curEvent;
-    //ES_Event thisEvent;
-    int8_t returnVal = FALSE;
-
-
-    int A = MTR_A_ENCA_BIT;
-    int B = MTR_A_ENCB_BIT;
-
-    //SM Code
-    int right_new_state = (A << 1) + B;
-    int right_encoder_step = enc_no_step; //no step by default
-    if (right_new_state != right_encoder_state) {
-        switch (right_encoder_state) {
-            case state_0_0:
-                //cw
-                if (right_new_state == state_1_0) {
-                    right_encoder_step = enc_increment;
-                }//ccw
-                else if (right_new_state == state_0_1) {
-                    right_encoder_step = enc_decrement;
-                }
-                break;
-            case state_1_0:
-                //cw
-                if (right_new_state == state_1_1) {
-                    right_encoder_step = enc_increment;
-                }//ccw
-                else if (right_new_state == state_0_0) {
-                    right_encoder_step = enc_decrement;
-                }
-                break;
-            case state_1_1:
-                //cw
-                if (right_new_state == state_0_1) {
-                    right_encoder_step = enc_increment;
-                }//ccw
-                else if (right_new_state == state_1_0) {
-                    right_encoder_step = enc_decrement;
-                }
-                break;
-
-            case state_0_1:
-                //cw
-                if (right_new_state == state_0_0) {
-                    right_encoder_step = enc_increment;
-                }//ccw
-                else if (right_new_state == state_1_1) {
-                    right_encoder_step = enc_decrement;
-                }
-                break;
-        }
+void TrackWire_PrintBand(void) {
+    uint8_t i;
+
+    for (i = 0; i < TW_CAL_SENSORS; i++) {
+        const TrackWireCal_Sensor_t *s = &trackwire_cal.sensor[i];
+        printf("TRACK WIRE %d: baseline %ld, noise %ld.%02ld, band %u to %u%s\n", i, (long) (s->base / 256),
+                (long) (s->noise / 256), (long) ((s->noise % 256) * 100 / 256), s->lower, s->upper,
+                TrackWireCal_Ready(&trackwire_cal, i) ? "" : " (calibrating)");
+    }
+}
 
-        //update state
-        right_encoder_state = right_new_state;
+uint8_t CheckSolenoid(void) {
+    static uint8_t was_busy = FALSE;
+    ES_Event thisEvent;
+    uint8_t returnVal = FALSE;
+    uint8_t busy = Robot_SolenoidBusy();
 
-        //update robot.c count
-        if (enc_increment == right_encoder_step) {
-            Robot_IncrementRightEnc();
-        } else if (enc_decrement == right_encoder_step) {
-            Robot_DecrementRightEnc();
+    if (was_busy && !busy) {
+        returnVal = TRUE;
+        thisEvent.EventType = BALL_FIRED;
+        thisEvent.EventParam = Robot_SolenoidLastPulses();
 
-        }
+#ifndef EVENTCHECKER_TEST           // keep this as is for test harness
+        PostRobotHSM(thisEvent);
+#else
+        SaveEvent(thisEvent);
+#endif  
     }
+    was_busy = busy;
     return (returnVal);
+}
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+//first scan block that starts settle_scans or more after now, for a detector
+//that was just switched
+static uint32_t FirstSettledBlock(uint16_t settle_scans) {
+    return (Robot_AdcScans() + settle_scans + HAL_ADC_BLOCK_LEN - 1) / HAL_ADC_BLOCK_LEN;
+}
+
+//puts the band of a sensor on the telemetry stream, one TELEM_TW_BAND frame
+//when it is first set and after it moved TRACKWIRE_TELEM_STEP, nothing on the
+//readings in between or for the slow drift
+static void TrackWire_SendBand(uint8_t sensor) {
+    uint16_t lower;
+    uint16_t upper;
+
+    TrackWireCal_GetBand(&trackwire_cal, sensor, &lower, &upper);
+    if ((abs(lower - trackwire_sent[sensor][0]) >= TRACKWIRE_TELEM_STEP)
+            || (abs(upper - trackwire_sent[sensor][1]) >= TRACKWIRE_TELEM_STEP)) {
+        Telem_Frame(TELEM_SRC_Robot, TELEM_TW_BAND, lower | ((uint16_t) sensor << 15),
+                (upper - lower > 255) ? 255 : upper - lower);
+        trackwire_sent[sensor][0] = lower;
+        trackwire_sent[sensor][1] = upper;
+    }
+}
 
+//amplitude weighted average of the detector directions, FALSE if nothing is
+//loud enough to trust
+static uint8_t BeaconBearing(const uint32_t *amplitude2, int16_t *bearing) {
+    int32_t sum = 0;
+    int32_t moment = 0;
+    int32_t amplitude;
+    uint8_t i;
+
+    for (i = 0; i < BEACON_NUM_DETECTORS; i++) {
+        amplitude = (int32_t) Fix_Sqrt32(amplitude2[i]) - BEACON_NOISE_AMPLITUDE;
+        if (amplitude > 0) {
+            sum += amplitude;
+            moment += amplitude * BeaconAngles[i];
+        }
+    }
+    if (sum < BEACON_BEARING_MIN_SUM) {
+        return FALSE;
+    }
+    *bearing = (int16_t) (moment / sum);
+    return TRUE;
 }
 
 /* 
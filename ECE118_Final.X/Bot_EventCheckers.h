@@ -32,6 +32,9 @@
 /*******************************************************************************
  * PUBLIC #DEFINES                                                             *
  ******************************************************************************/
+//CheckBeacon modes
+#define BEACON_SCAN_FRONT 0 //front detector only, fastest BEACON_CHANGED for tracking
+#define BEACON_SCAN_ALL 1 //left, front, right in turn, also posts BEACON_BEARING
 
 
 /*******************************************************************************
@@ -59,23 +62,40 @@
  * @modified Gabriel H Elkaim/Max Dunne, 2016.09.12 20:08 */
 uint8_t CheckBattery(void);
 
-//Checks for change in state of any of on-board tape sensors (detecting or not detecting black tape)
+//Checks for change in state of any of on-board tape sensors (detecting or not detecting black tape),
+//each sensor has to hold TAPE_FILTER_N of TAPE_FILTER_M ms to change (tape_filter.h)
 uint8_t CheckTape(void);
+void Tape_PrintFilterStats(void); //raw vs posted tape edges, with printf
 
-//Checks for change in state of any of on-board bump sensors (bumped or not bumped)
+//Checks for change in state of any of on-board bump sensors (bumped or not bumped),
+//posts BUMPERS_CHANGED BUMPER_DEBOUNCE_MS after a bumper settles
 uint8_t CheckBumper(void);
 
-//Checks for change in state of left encoder and updates count
-//Note: encoder code reused and adapted from code written by Aram for his ECE 167 Lab 2
-uint8_t CheckLeftEncoder(void);
+//Note: the encoders are no longer polled here, they are decoded in the encoder
+//interrupt (Robot_EncoderISR in robot.c)
 
-//Checks for change in state of right encoder and updates count
-//Note: encoder code reused and adapted from code written by Aram for his ECE 167 Lab 2
-uint8_t CheckRightEncoder(void);
-
-//Checks each beacon detector consecutively, using averaging of samples to smooth noise
+//Checks the beacon detectors for the beacon tone, one Goertzel block (5 ms of
+//samples, see beacon_goertzel.h) per detector. In BEACON_SCAN_ALL every round
+//of the three detectors also estimates the bearing of the beacon from their
+//relative amplitudes and posts BEACON_BEARING when it moved (param is a binary
+//angle, 65536 = 360 deg, read as int16_t: positive is to the left)
 uint8_t CheckBeacon(void);
+void Beacon_SetScanMode(uint8_t mode);
 
+//Checks the two track wire sensors one scan block at a time with a sequential test
+//against each one's self calibrated band (trackwire_cal.h), switching sensors only
+//when the other one's reading is needed. Posts TRACK_WIRE_CHANGED when both are on
+//(param 1) or either drops out after both were (param 0)
 uint8_t CheckTrackWire(void);
+void TrackWire_GetBand(uint8_t sensor, uint16_t *lower, uint16_t *upper); //0, 0 until calibrated
+void TrackWire_PrintBand(void); //baseline, noise floor and band of each sensor, with printf
+
+//Posts BALL_FIRED when a Robot_SolenoidFire pulse train has finished
+uint8_t CheckSolenoid(void);
+
+#ifdef ROBOT_HOST
+//Advances the host virtual clock and expires ES timers (host/ES_Port_Host.c)
+uint8_t CheckHostClock(void);
+#endif
 #endif	/* BOT_EVENTCHECKERS_H */
 
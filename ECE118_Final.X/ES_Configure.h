@@ -22,8 +22,30 @@
 //What State machine are we testing
 //#define POSTFUNCTION_FOR_KEYBOARD_INPUT PostRobotHSM
 
+//binary trace frames on the telemetry UART2 (telemetry.h, telem_trace.h)
+//instead of the TattleTale text trace. Off until the UART2 drain has been run
+//on the robot, the host build turns it on
+//#define USE_TELEMETRY
+
+#ifndef USE_TELEMETRY
 //define for TattleTale
 #define USE_TATTLETALE
+#endif
+
+//uncomment to time every event checker and service Run function, see
+//loop_profiler.h. Turns on the keyboard input for the dump key. The host
+//build defines it with "make PROFILE=1" and prints the table at exit
+//#define USE_PROFILER
+
+#ifdef USE_PROFILER
+#define PROFILED(fn) Prof_##fn
+#ifndef USE_KEYBOARD_INPUT
+#define USE_KEYBOARD_INPUT
+#define POSTFUNCTION_FOR_KEYBOARD_INPUT PostRobotHSM
+#endif
+#else
+#define PROFILED(fn) fn
+#endif
 
 //uncomment to supress the entry and exit events
 #define SUPPRESS_EXIT_ENTRY_IN_TATTLE
@@ -59,11 +81,14 @@ typedef enum {
     DEAD_BOT_DETECTED,
     CORNER_TRAVERSED,
             TEMP_OVER,
+    BEACON_BEARING, /* param is the bearing as a binary angle, see CheckBeacon */
+    BALL_FIRED, /* solenoid pulse train done, param is the number of pulses */
+    MOVE_COMPLETE, /* move done, param MOVE_RESULT and sequence, see Motion_IsCurrent */
     /* User-defined events end here */
     NUMBEROFEVENTS,
 } ES_EventTyp_t;
 
-static const char *EventNames[] = {
+static const char * const EventNames[] = { //const, so files that do not print it get no unused warning
 	"ES_NO_EVENT",
 	"ES_ERROR",
 	"ES_INIT",
@@ -89,6 +114,9 @@ static const char *EventNames[] = {
 	"DEAD_BOT_DETECTED",
 	"CORNER_TRAVERSED",
 	"TEMP_OVER",
+	"BEACON_BEARING",
+	"BALL_FIRED",
+	"MOVE_COMPLETE",
 	"NUMBEROFEVENTS",
 };
 
@@ -97,23 +125,32 @@ static const char *EventNames[] = {
 
 /****************************************************************************/
 // This are the name of the Event checking function header file.
+#ifndef USE_PROFILER
 #define EVENT_CHECK_HEADER "Bot_EventCheckers.h"
+#else
+#define EVENT_CHECK_HEADER "loop_profiler.h" //declares the Prof_ wrappers, includes Bot_EventCheckers.h
+#endif
 
 /****************************************************************************/
 // This is the list of event checking functions
-#define EVENT_CHECK_LIST  CheckBattery, CheckTape, CheckBeacon, CheckTrackWire
+#ifndef ROBOT_HOST
+#define EVENT_CHECK_LIST  PROFILED(CheckBattery), PROFILED(CheckTape), PROFILED(CheckBumper), PROFILED(CheckBeacon), PROFILED(CheckTrackWire), PROFILED(CheckSolenoid)
+#else
+// host build: CheckHostClock advances the virtual clock, keep it first
+#define EVENT_CHECK_LIST  CheckHostClock, PROFILED(CheckBattery), PROFILED(CheckTape), PROFILED(CheckBumper), PROFILED(CheckBeacon), PROFILED(CheckTrackWire), PROFILED(CheckSolenoid)
+#endif
 
 /****************************************************************************/
 // These are the definitions for the post functions to be executed when the
 // corresponding timer expires. All 16 must be defined. If you are not using
 // a timers, then you can use TIMER_UNUSED
 #define TIMER_UNUSED ((pPostFunc)0)
-#define TIMER0_RESP_FUNC PostManeuverService
-#define TIMER1_RESP_FUNC PostBumperDebounceService
-#define TIMER2_RESP_FUNC PostWaitService
-#define TIMER3_RESP_FUNC PostLostService
-#define TIMER4_RESP_FUNC PostTempService
-#define TIMER5_RESP_FUNC TIMER_UNUSED
+#define TIMER0_RESP_FUNC PostTimerEvent
+#define TIMER1_RESP_FUNC TIMER_UNUSED
+#define TIMER2_RESP_FUNC PostTimerEvent
+#define TIMER3_RESP_FUNC PostTimerEvent
+#define TIMER4_RESP_FUNC PostTimerEvent
+#define TIMER5_RESP_FUNC PostVelocityService
 #define TIMER6_RESP_FUNC TIMER_UNUSED
 #define TIMER7_RESP_FUNC TIMER_UNUSED
 #define TIMER8_RESP_FUNC TIMER_UNUSED
@@ -134,12 +171,13 @@ static const char *EventNames[] = {
 
 //#define TRACK_WIRE_SERVICE_TIMER 0
 //#define BEACON_SERVICE_TIMER 1
-#define MANEUVER_SERVICE_TIMER 0
+#define MANEUVER_SERVICE_TIMER 0 //maneuver, wait, lost and temp go through PostTimerEvent
 
-#define BUMPER_DEBOUNCE_SERVICE_TIMER 1
+//timer 1 is free, the bumpers are debounced in the 1 ms tick (Robot_TickISR)
 #define WAIT_SERVICE_TIMER 2
 #define LOST_SERVICE_TIMER 3
 #define TEMP_SERVICE_TIMER 4
+#define VELOCITY_SERVICE_TIMER 5
 
 
 
@@ -152,7 +190,7 @@ static const char *EventNames[] = {
 /****************************************************************************/
 // This macro determines that nuber of services that are *actually* used in
 // a particular application. It will vary in value from 1 to MAX_NUM_SERVICES
-#define NUM_SERVICES 7
+#define NUM_SERVICES 3
 
 /****************************************************************************/
 // These are the definitions for Service 0, the lowest priority service
@@ -160,11 +198,15 @@ static const char *EventNames[] = {
 // services are added in numeric sequence (1,2,3,...) with increasing 
 // priorities
 // the header file with the public fuction prototypes
+#ifndef USE_PROFILER
 #define SERV_0_HEADER "ES_KeyboardInput.h"
+#else
+#define SERV_0_HEADER "loop_profiler.h" //declares the Prof_ wrappers, includes ES_KeyboardInput.h
+#endif
 // the name of the Init function
 #define SERV_0_INIT InitKeyboardInput
 // the name of the run function
-#define SERV_0_RUN RunKeyboardInput
+#define SERV_0_RUN PROFILED(RunKeyboardInput)
 // How big should this service's Queue be?
 #define SERV_0_QUEUE_SIZE 9
 
@@ -176,9 +218,9 @@ static const char *EventNames[] = {
 // the name of the Init function
 #define SERV_1_INIT InitRobotHSM
 // the name of the run function
-#define SERV_1_RUN RunRobotHSM
+#define SERV_1_RUN PROFILED(RunRobotHSM)
 // How big should this services Queue be?
-#define SERV_1_QUEUE_SIZE 3
+#define SERV_1_QUEUE_SIZE 4 //worst "need" in make stress, see queue_stats.h
 #endif
 
 // These are the definitions for Service 2
@@ -186,79 +228,16 @@ static const char *EventNames[] = {
 // the header file with the public fuction prototypes
 #define SERV_2_HEADER "robot_services.h"
 // the name of the Init function
-#define SERV_2_INIT InitManeuverService
+#define SERV_2_INIT InitVelocityService
 // the name of the run function
-#define SERV_2_RUN RunManeuverService
+#define SERV_2_RUN PROFILED(RunVelocityService)
 // How big should this services Queue be?
 #define SERV_2_QUEUE_SIZE 3
 #endif
 
-
-
-/****************************************************************************/
-// These are the definitions for Service 3
-#if NUM_SERVICES > 3
-// the header file with the public fuction prototypes
-#define SERV_3_HEADER "robot_services.h"
-// the name of the Init function
-#define SERV_3_INIT InitBumperDebounceService
-// the name of the run function
-#define SERV_3_RUN RunBumperDebounceService
-// How big should this services Queue be?
-#define SERV_3_QUEUE_SIZE 3
-#endif
-
-/****************************************************************************/
-// These are the definitions for Service 4
-#if NUM_SERVICES > 4
-// the header file with the public fuction prototypes
-#define SERV_4_HEADER "robot_services.h"
-// the name of the Init function
-#define SERV_4_INIT InitWaitService
-// the name of the run function
-#define SERV_4_RUN RunWaitService
-// How big should this services Queue be?
-#define SERV_4_QUEUE_SIZE 3
-#endif
-
-/****************************************************************************/
-// These are the definitions for Service 5
-#if NUM_SERVICES > 5
-// the header file with the public fuction prototypes
-#define SERV_5_HEADER "robot_services.h"
-// the name of the Init function
-#define SERV_5_INIT InitLostService
-// the name of the run function
-#define SERV_5_RUN RunLostService
-// How big should this services Queue be?
-#define SERV_5_QUEUE_SIZE 3
-#endif
-
-/****************************************************************************/
-// These are the definitions for Service 6
-#if NUM_SERVICES > 6
-// the header file with the public fuction prototypes
-#define SERV_6_HEADER "robot_services.h"
-// the name of the Init function
-#define SERV_6_INIT InitTempService
-// the name of the run function
-#define SERV_6_RUN RunTempService
-// How big should this services Queue be?
-#define SERV_6_QUEUE_SIZE 3
-#endif
-
-/****************************************************************************/
-// These are the definitions for Service 7
-#if NUM_SERVICES > 7
-// the header file with the public fuction prototypes
-#define SERV_7_HEADER "TestService.h"
-// the name of the Init function
-#define SERV_7_INIT TestServiceInit
-// the name of the run function
-#define SERV_7_RUN TestServiceRun
-// How big should this services Queue be?
-#define SERV_7_QUEUE_SIZE 3
-#endif
+// Services 3 to 7 are free, the maneuver/wait/lost/temp timers post straight
+// to RobotHSM through PostTimerEvent (robot_services.c) and the bumpers are
+// debounced in the 1 ms tick and posted by CheckBumper
 
 /****************************************************************************/
 // the name of the posting function that you want executed when a new 
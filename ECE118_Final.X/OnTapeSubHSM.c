@@ -32,11 +32,13 @@
 #include "BOARD.h"
 #include "RobotHSM.h"
 #include "OnTapeSubHSM.h"
-#include "Robot.h"
+#include "robot.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
+#define TELEM_SOURCE TELEM_SRC_OnTapeSubHSM
+#include "telem_trace.h"
 
 typedef enum {
     InitPSubState,
@@ -37,9 +37,14 @@
 #include "OnTapeSubHSM.h"
 #include "TapeSubState.h"
 #include "robot.h"
+#include "robot_services.h"
 #include "TowerAlignSubHSM.h"
 #include "TowerTraverseSubHSM.h"
 #include "TowerShootSubHSM.h"
+#include "Bot_EventCheckers.h"
+#include "fixed_math.h"
+#include "queue_stats.h"
+#include "event_trace.h"
 #include "stdio.h"
 /*******************************************************************************
  * PRIVATE #DEFINES                                                            *
@@ -48,31 +53,17 @@
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
+#define TELEM_SOURCE TELEM_SRC_RobotHSM
+#include "telem_trace.h"
+#define SPIN_SCAN_SPEED 80 //Spin_Scan turn speed when the beacon is far off to one side
+#define SPIN_SCAN_MIN_SPEED 30
+#define SPIN_SCAN_GAIN 2 //motor speed per degree of beacon bearing
+#define BACK_OFF_MM 135 //back off a bump before TowerAlignSubHSM, what the old 500 ms covered on a fresh pack
+#define BACK_OFF_SPEED 80
 
 
-typedef enum {
-    InitPState,
-    Set_Up, //bot waits for 0.5 seconds to wait for false HIGH signal from beacon detector to go away
-    Spin_Scan, //spinning in place to scan for beacon
-    Towards_Tower, //approaching tower, adjusting direction to stay on course
-    At_Tower, //at tower and working to put ball into correct hole
-    Perimeter_Scan, //at tower after ball deposit, following perimeter while scanning with side beacon detector
-    On_Tape, //tape following around corners, scanning for beacon on corners
-    Lost, //any state where moving and not going towards tower, ie waiting to bounce of tape
-    Traverse_Scan,
-} TemplateHSMState_t;
-
-static const char *StateNames[] = {
-	"InitPState",
-	"Set_Up",
-	"Spin_Scan",
-	"Towards_Tower",
-	"At_Tower",
-	"Perimeter_Scan",
-	"On_Tape",
-	"Lost",
-	"Traverse_Scan",
-};
+//states, StateNames[] and the transition tables come from RobotHSM.hsm
+#include "RobotHSM_table.h"
 
 
 /*******************************************************************************
@@ -87,7 +78,7 @@ static const char *StateNames[] = {
 /* You will need MyPriority and the state variable; you may need others as well.
  * The type of state variable should match that of enum in header file. */
 
-static TemplateHSMState_t CurrentState = InitPState; // <- change enum name to match ENUM
+static uint8_t CurrentState = InitPState; // <- change enum name to match ENUM
 static uint8_t MyPriority;
 
 
@@ -110,7 +101,7 @@ uint8_t InitRobotHSM(uint8_t Priority) {
     // put us into the Initial PseudoState
     CurrentState = InitPState;
     // post the initial transition event
-    if (ES_PostToService(MyPriority, INIT_EVENT) == TRUE) {
+    if (QStat_Post(MyPriority, INIT_EVENT) == TRUE) {
         return TRUE;
     } else {
         return FALSE;
@@ -127,7 +118,7 @@ uint8_t InitRobotHSM(uint8_t Priority) {
  *        Returns TRUE if successful, FALSE otherwise
  * @author J. Edward Carryer, 2011.10.23 19:25 */
 uint8_t PostRobotHSM(ES_Event ThisEvent) {
-    return ES_PostToService(MyPriority, ThisEvent);
+    return QStat_Post(MyPriority, ThisEvent);
 }
 
 /**
@@ -146,311 +137,23 @@ uint8_t PostRobotHSM(ES_Event ThisEvent) {
  * @author J. Edward Carryer, 2011.10.23 19:25
  * @author Gabriel H Elkaim, 2011.10.23 19:25 */
 ES_Event RunRobotHSM(ES_Event ThisEvent) {
-    uint8_t makeTransition = FALSE; // use to flag transition
-    TemplateHSMState_t nextState; // <- change type to correct enum
+    ES_Event Delivered = ThisEvent; //HSM_Dispatch consumes ThisEvent
+    uint8_t FromState = CurrentState;
+    uint8_t FromSub = HSM_SubState(&RobotHSMMachine, CurrentState);
 
     ES_Tattle(); // trace call stack
+    QStat_Dequeued(MyPriority); //ES_Run took ThisEvent off our queue
 
-    switch (CurrentState) {
-        case InitPState: // If current state is initial Pseudo State
-            if (ThisEvent.EventType == ES_INIT)// only respond to ES_Init
-            {
-                printf("Init State!\n");
-
-                // Init Transition Actions
-                ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 400);
-
-                // Initialize all sub-state machines
-                InitTowardsTowerSubHSM();
-                //InitOnTapeSubHSM();
-                InitTapeSubState();
-                InitTowerAlignSubHSM();
-                InitTowerTraverseSubHSM();
-                InitTowerShootSubHSM();
-                InitAtTowerSubHSM();
-
-                // now put the machine into the actual initial state
-                nextState = Set_Up;
-                makeTransition = TRUE;
-                ThisEvent.EventType = ES_NO_EVENT;
-
-            }
-            break;
-        case Set_Up:
-            switch (ThisEvent.EventType) {
-                case ES_NO_EVENT:
-                    break;
-                case MANEUVER_OVER: //maybe only begin manuever timer if battery connected
-
-                    //begin spinning in place
-                    Robot_LeftMtrSpeed(80);
-                    Robot_RightMtrSpeed(-80);
-
-
-                    nextState = Spin_Scan;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    break;
-
-                default:
-                    break;
-            }
-            break;
-        case Spin_Scan:
-            switch (ThisEvent.EventType) {
-                case ES_NO_EVENT:
-                    break;
-                case BEACON_CHANGED:
-                    //if front beacon is detecting
-                    if (ThisEvent.EventParam & FRONT_BEACON_MASK) {
-                        //begin approaching beacon
-                        Robot_LeftMtrSpeed(100);
-                        Robot_RightMtrSpeed(100);
-
-                        nextState = Towards_Tower;
-                        makeTransition = TRUE;
-                        ThisEvent.EventType = ES_NO_EVENT;
-                    }
-                    break;
-                case BUMPERS_CHANGED: //edge cases: bot runs into us or we are near beacon
-                    break;
-                default:
-                    break;
-            }
-            break;
-        case Towards_Tower:
-            ThisEvent = RunTowardsTowerSubHSM(ThisEvent);
-
-
-            switch (ThisEvent.EventType) {
-                case ES_NO_EVENT:
-                    break;
-                case BUMPERS_CHANGED: //need to account for hitting other bot case
-                    //might want to only react to front bumpers, back would not make sense
-                    //stop running (might change depending on at tower behavior)
-                    Robot_LeftMtrSpeed(-80);
-                    Robot_RightMtrSpeed(-80);
-                    ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 500);
-
-                    nextState = At_Tower;
-                    makeTransition = TRUE;
-                    PostRobotHSM(ThisEvent); //todo: see if this is a valid way to repost event. Check for tape as well
-
-                    ResetTowardsTowerSubHSM(); //todo; check with jason if this is correct place
-                    ThisEvent.EventType = ES_NO_EVENT;
-
-                    break;
-                case TAPE_CHANGED:
-                    if (ThisEvent.EventParam & (ALL_FLOOR_TAPE_MASK)) {
-
-                        nextState = On_Tape;
-                        makeTransition = TRUE;
-                        PostRobotHSM(ThisEvent); //todo: check if this is valid way to repost
-
-                        ThisEvent.EventType = ES_NO_EVENT;
-                        ResetTowardsTowerSubHSM(); //todo; check with jason if this is correct place
-                    }
-                    break;
-                default:
-                    break;
-                    //  }
-            }
-            break;
-        case At_Tower:
-
-            ThisEvent = RunAtTowerSubHSM(ThisEvent);
-
-
-            switch (ThisEvent.EventType) {
-                case ES_NO_EVENT:
-                    break;
-                case DEAD_BOT_DETECTED:
-                    Robot_LeftMtrSpeed(100);
-                    Robot_RightMtrSpeed(100);
-                    nextState = Lost;
-                    makeTransition = TRUE;
-                    ResetAtTowerSubHSM();
-                    break;
-                    //case TAPE_CHANGED:
-
-                    //THIS SHOULD NOT BE REACHED: TAPE EVENTS SHOULD BE HANDLED AND
-                    //CONSUMED IN THE AT TOWER SM. Having this case here is a fail safe
-                    //                    if (ThisEvent.EventParam & (ALL_FLOOR_TAPE_MASK)) {
-                    //                        nextState = On_Tape;
-                    //                        makeTransition = TRUE;
-                    //                        PostRobotHSM(ThisEvent); //todo: check if this is valid way to repost
-                    //
-                    //                        ThisEvent.EventType = ES_NO_EVENT;
-                    //                        //todo: reset at tower SM
-                    //                        ResetAtTowerSubHSM();
-                    //                    }
-                    //break;
-
-                    //                case BALL_DEPOSITED: //to-do: change. The attower state macine
-                    //                    //should search for a beacon after
-                    //                    //depositing, then after finding one we
-                    //                    //should enter approaching state here
-                    //                    Robot_LeftMtrSpeed(80);
-                    //                    Robot_RightMtrSpeed(-80);
-                    //                    nextState = Spin_Scan;
-                    //                    makeTransition = TRUE;
-                    //
-                    //                    ThisEvent.EventType = ES_NO_EVENT;
-                    //                    break;
-
-                    //                case TAPE_CHANGED:
-                    //                    nextState = On_Tape;
-                    //                    makeTransition = TRUE;
-                    //                    PostRobotHSM(ThisEvent); //todo: check if this is valid way to repost
-                    //
-                    //                    ThisEvent.EventType = ES_NO_EVENT;
-                    //                    break;
-                    //                    //todo: reset at tower SM
-                case BALL_DEPOSITED:
-                    Robot_LeftMtrSpeed(90);
-                    Robot_RightMtrSpeed(100);
-                    nextState = Traverse_Scan;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    ResetAtTowerSubHSM();
-                    break;
-                    
-                case LOST_OVER:
-                    Robot_LeftMtrSpeed(100);
-                    Robot_RightMtrSpeed(100);
-                    nextState = Lost;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    ResetAtTowerSubHSM();
-
-                    break;
-                default:
-                    break;
-                    //  }
-            }
-            break;
-        case On_Tape:
-            ThisEvent = RunTapeSubState(ThisEvent);
-            switch (ThisEvent.EventType) {
-                case ES_NO_EVENT:
-                    break;
-                case BUMPERS_CHANGED:
-                    if ((FRONT_LEFT_BMP_MASK | FRONT_RIGHT_BMP_MASK) & ThisEvent.EventParam) { //if any bumper pressed
-                        Robot_LeftMtrSpeed(-80);
-                        Robot_RightMtrSpeed(-80);
-                        ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 500);
-
-                        nextState = At_Tower;
-                        makeTransition = TRUE;
-                        PostRobotHSM(ThisEvent); //todo: see if this is a valid way to repost event. Check for tape as well
-
-                        ResetTapeSubState(); //todo; check with jason if this is correct place
-                        ThisEvent.EventType = ES_NO_EVENT;
-                    }
-                    ThisEvent.EventType = ES_NO_EVENT;
-
-                    break;
-
-                case ESCAPED_TAPE:
-                    //begin spinning towards bumped side
-                    if (ThisEvent.EventParam & FRONT_LEFT_TAPE_MASK) { //to-do: see if this works?
-                        //spin to left
-                        Robot_LeftMtrSpeed(-80);
-                        Robot_RightMtrSpeed(80);
-                    } else {
-                        Robot_RightMtrSpeed(-80);
-                        Robot_LeftMtrSpeed(80);
-                    }
-
-                    ResetTapeSubState(); //todo- check with jason if should be here or in exit event case
-                    nextState = Spin_Scan;
-                    makeTransition = TRUE;
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    break;
-                default:
-                    break;
-            }
-            break;
-        case Lost:
-            switch (ThisEvent.EventType) {
-                case ES_NO_EVENT:
-                    break;
-                case TAPE_CHANGED:
-
-                    //                    if (ThisEvent.EventParam & (ALL_FLOOR_TAPE_MASK)) {
-                    //                        nextState = On_Tape;
-                    //                        makeTransition = TRUE;
-                    //                        PostRobotHSM(ThisEvent); //todo: check if this is valid way to repost
-                    //
-                    //                        ThisEvent.EventType = ES_NO_EVENT;
-                    //                    }
-                    if (ThisEvent.EventParam & (ALL_FLOOR_TAPE_MASK)) {
-                        Robot_LeftMtrSpeed(-80);
-                        Robot_RightMtrSpeed(80);
-
-                        nextState = Spin_Scan;
-                        makeTransition = TRUE;
-                        ThisEvent.EventType = ES_NO_EVENT;
-                    }
-                    ThisEvent.EventType = ES_NO_EVENT;
-
-                    break;
-                case BEACON_CHANGED:
-                    //if front beacon is detecting
-                    if (ThisEvent.EventParam & FRONT_BEACON_MASK) {
-                        //begin approaching beacon
-                        Robot_LeftMtrSpeed(100);
-                        Robot_RightMtrSpeed(100);
-
-                        nextState = Towards_Tower;
-                        makeTransition = TRUE;
-                        ThisEvent.EventType = ES_NO_EVENT;
-                    }
-                    break;
-                default: // all unhandled states fall into here
-                    break;
-
-            } // end switch on Current State
-            break;
-        case Traverse_Scan:
-            ThisEvent = RunTowerTraverseSubHSM(ThisEvent);
-
-            switch (ThisEvent.EventType) {
-                case ES_ENTRY:
-                    //ES_Timer_InitTimer(LOST_SERVICE_TIMER, TIMEOUT);
-                    break;
-
-                case ES_NO_EVENT:
-                    break;
-                case ES_EXIT:
-                    //ES_Timer_StopTimer(LOST_SERVICE_TIMER);
-                    ThisEvent.EventType = ES_NO_EVENT;
-                    break;
-                case BEACON_CHANGED:
-                    //if front beacon is detecting
-                    if (ThisEvent.EventParam & FRONT_BEACON_MASK) {
-                        //begin approaching beacon
-                        Robot_LeftMtrSpeed(100);
-                        Robot_RightMtrSpeed(90);
-
-                        nextState = Towards_Tower;
-                        makeTransition = TRUE;
-                        ThisEvent.EventType = ES_NO_EVENT;
-                        ResetTowerTraverseSubHSM();
-
-                    }
-                default:
-                    break;
-            }
-            break;
-    }
-    if (makeTransition == TRUE) { // making a state transition, send EXIT and ENTRY
-        // recursively call the current state with an exit event
-        RunRobotHSM(EXIT_EVENT); // <- rename to your own Run function
-        CurrentState = nextState;
-        RunRobotHSM(ENTRY_EVENT); // <- rename to your own Run function
+    //the state that started the move has left, or started another since
+    if ((MOVE_COMPLETE == ThisEvent.EventType) && !Motion_IsCurrent(ThisEvent.EventParam)) {
+        ThisEvent.EventType = ES_NO_EVENT;
+        ES_Tail();
+        return ThisEvent;
     }
 
+    HSM_Dispatch(&RobotHSMMachine, &CurrentState, &ThisEvent);
+    Trace_Record(&Delivered, FromState, FromSub, CurrentState, HSM_SubState(&RobotHSMMachine, CurrentState));
+
     ES_Tail(); // trace call stack end
     return ThisEvent;
 }
@@ -459,3 +162,138 @@ ES_Event RunRobotHSM(ES_Event ThisEvent) {
 /*******************************************************************************
  * PRIVATE FUNCTIONS                                                           *
  ******************************************************************************/
+
+//guards
+
+static uint8_t FrontBeacon(const ES_Event *ThisEvent) {
+    return ((ThisEvent->EventParam & FRONT_BEACON_MASK) != 0);
+}
+
+static uint8_t FloorTape(const ES_Event *ThisEvent) {
+    return ((ThisEvent->EventParam & ALL_FLOOR_TAPE_MASK) != 0);
+}
+
+static uint8_t FrontBumper(const ES_Event *ThisEvent) {
+    return (((FRONT_LEFT_BMP_MASK | FRONT_RIGHT_BMP_MASK) & ThisEvent->EventParam) != 0);
+}
+
+//actions
+
+static void StartMatch(ES_Event *ThisEvent) {
+    printf("Init State!\n");
+
+    // Init Transition Actions
+    ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 400);
+
+    // Initialize all sub-state machines
+    InitTowardsTowerSubHSM();
+    //InitOnTapeSubHSM();
+    InitTapeSubState();
+    InitTowerAlignSubHSM();
+    InitTowerTraverseSubHSM();
+    InitTowerShootSubHSM();
+    InitAtTowerSubHSM();
+}
+
+static void SpinRight(ES_Event *ThisEvent) {
+    //begin spinning in place, maybe only begin manuever timer if battery connected
+    Robot_LeftMtrSpeed(80);
+    Robot_RightMtrSpeed(-80);
+}
+
+static void SpinLeft(ES_Event *ThisEvent) {
+    Robot_LeftMtrSpeed(-80);
+    Robot_RightMtrSpeed(80);
+}
+
+static void SteerToBearing(ES_Event *ThisEvent) {
+    //turn toward the beacon instead of spinning one way until the front
+    //detector trips, slowing down as it comes around
+    int spin_speed = ANGLE_TO_DEG(ThisEvent->EventParam) * SPIN_SCAN_GAIN;
+
+    if (spin_speed > SPIN_SCAN_SPEED) {
+        spin_speed = SPIN_SCAN_SPEED;
+    } else if (spin_speed < -SPIN_SCAN_SPEED) {
+        spin_speed = -SPIN_SCAN_SPEED;
+    } else if ((spin_speed >= 0) && (spin_speed < SPIN_SCAN_MIN_SPEED)) {
+        spin_speed = SPIN_SCAN_MIN_SPEED;
+    } else if ((spin_speed < 0) && (spin_speed > -SPIN_SCAN_MIN_SPEED)) {
+        spin_speed = -SPIN_SCAN_MIN_SPEED;
+    }
+    Robot_LeftMtrSpeed(-spin_speed);
+    Robot_RightMtrSpeed(spin_speed);
+}
+
+static void ApproachTower(ES_Event *ThisEvent) {
+    Robot_LeftMtrSpeed(100);
+    Robot_RightMtrSpeed(100);
+}
+
+static void ApproachFromTraverse(ES_Event *ThisEvent) {
+    Robot_LeftMtrSpeed(100);
+    Robot_RightMtrSpeed(90);
+    ResetTowerTraverseSubHSM();
+}
+
+static void BackOffTowards(ES_Event *ThisEvent) {
+    //need to account for hitting other bot case, back bumpers would not make sense
+    //At_Tower's entry backs off
+    HSM_Recall(*ThisEvent); //At_Tower/AtTowerSubHSM sees the bump too
+    ResetTowardsTowerSubHSM();
+}
+
+static void LeaveTowardsForTape(ES_Event *ThisEvent) {
+    HSM_Recall(*ThisEvent); //TapeSubState starts from the tape that got us here
+    ResetTowardsTowerSubHSM();
+}
+
+static void LeaveAtTower(ES_Event *ThisEvent) {
+    Robot_LeftMtrSpeed(100);
+    Robot_RightMtrSpeed(100);
+    ResetAtTowerSubHSM();
+}
+
+static void StartTraverse(ES_Event *ThisEvent) {
+    Robot_LeftMtrSpeed(90);
+    Robot_RightMtrSpeed(100);
+    ResetAtTowerSubHSM();
+}
+
+static void BackOffTape(ES_Event *ThisEvent) {
+    //At_Tower's entry backs off
+    HSM_Recall(*ThisEvent); //At_Tower/AtTowerSubHSM sees the bump too
+    ResetTapeSubState();
+}
+
+static void SpinOffTape(ES_Event *ThisEvent) {
+    //begin spinning towards bumped side
+    if (ThisEvent->EventParam & FRONT_LEFT_TAPE_MASK) {
+        Robot_LeftMtrSpeed(-80);
+        Robot_RightMtrSpeed(80);
+    } else {
+        Robot_RightMtrSpeed(-80);
+        Robot_LeftMtrSpeed(80);
+    }
+    ResetTapeSubState();
+}
+
+//entry/exit hooks
+
+static void SpinScanEntry(void) {
+    Beacon_SetScanMode(BEACON_SCAN_ALL); //read the side detectors for BEACON_BEARING
+}
+
+static void SpinScanExit(void) {
+    Beacon_SetScanMode(BEACON_SCAN_FRONT);
+}
+
+//runs after AtTowerSubHSM got its ES_ENTRY, TowerAlignSubHSM waits in Adjust
+//for this move's MOVE_COMPLETE
+
+static void AtTowerEntry(void) {
+    Motion_Straight(-BACK_OFF_MM, BACK_OFF_SPEED);
+}
+
+static void AtTowerExit(void) {
+    Motion_Cancel();
+}
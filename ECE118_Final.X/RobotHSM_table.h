@@ -0,0 +1,110 @@
+/*
+ * File:   RobotHSM_table.h
+ *
+ * Generated by host/hsm_gen from RobotHSM.hsm, edit the spec and run "make hsm"
+ * in host/ instead of editing this file. Included once, by RobotHSM.c.
+ */
+
+#ifndef ROBOTHSM_TABLE_H
+#define ROBOTHSM_TABLE_H
+
+#include <stddef.h>
+#include "hsm_engine.h"
+
+typedef enum {
+    InitPState,
+    Set_Up,
+    Spin_Scan,
+    Towards_Tower,
+    At_Tower,
+    Perimeter_Scan,
+    On_Tape,
+    Lost,
+    Traverse_Scan,
+    ROBOTHSM_NUM_STATES,
+} RobotHSMState_t;
+
+static const char *StateNames[] = {
+    "InitPState",
+    "Set_Up",
+    "Spin_Scan",
+    "Towards_Tower",
+    "At_Tower",
+    "Perimeter_Scan",
+    "On_Tape",
+    "Lost",
+    "Traverse_Scan",
+};
+
+//guards, actions and hooks, defined in RobotHSM.c
+static uint8_t FrontBeacon(const ES_Event *ThisEvent);
+static uint8_t FloorTape(const ES_Event *ThisEvent);
+static uint8_t FrontBumper(const ES_Event *ThisEvent);
+static void StartMatch(ES_Event *ThisEvent);
+static void SpinRight(ES_Event *ThisEvent);
+static void SteerToBearing(ES_Event *ThisEvent);
+static void ApproachTower(ES_Event *ThisEvent);
+static void BackOffTowards(ES_Event *ThisEvent);
+static void LeaveTowardsForTape(ES_Event *ThisEvent);
+static void LeaveAtTower(ES_Event *ThisEvent);
+static void StartTraverse(ES_Event *ThisEvent);
+static void BackOffTape(ES_Event *ThisEvent);
+static void SpinOffTape(ES_Event *ThisEvent);
+static void SpinLeft(ES_Event *ThisEvent);
+static void ApproachFromTraverse(ES_Event *ThisEvent);
+static void SpinScanEntry(void);
+static void SpinScanExit(void);
+static void AtTowerEntry(void);
+static void AtTowerExit(void);
+
+static const HSM_State_t RobotHSMStates[ROBOTHSM_NUM_STATES] = {
+    [InitPState] = {NULL, NULL, NULL, NULL},
+    [Set_Up] = {NULL, NULL, NULL, NULL},
+    [Spin_Scan] = {SpinScanEntry, SpinScanExit, NULL, NULL},
+    [Towards_Tower] = {NULL, NULL, RunTowardsTowerSubHSM, QueryTowardsTowerSubHSM},
+    [At_Tower] = {AtTowerEntry, AtTowerExit, RunAtTowerSubHSM, QueryAtTowerSubHSM},
+    [Perimeter_Scan] = {NULL, NULL, NULL, NULL},
+    [On_Tape] = {NULL, NULL, RunTapeSubState, QueryTapeSubState},
+    [Lost] = {NULL, NULL, NULL, NULL},
+    [Traverse_Scan] = {NULL, NULL, RunTowerTraverseSubHSM, QueryTowerTraverseSubHSM},
+};
+
+static const HSM_Transition_t RobotHSMTransitions[] = {
+    {NULL, StartMatch, Set_Up}, //InitPState ES_INIT
+    {NULL, SpinRight, Spin_Scan}, //Set_Up MANEUVER_OVER
+    {NULL, SteerToBearing, HSM_NO_STATE}, //Spin_Scan BEACON_BEARING
+    {FrontBeacon, ApproachTower, Towards_Tower}, //Spin_Scan BEACON_CHANGED
+    {NULL, BackOffTowards, At_Tower}, //Towards_Tower BUMPERS_CHANGED
+    {FloorTape, LeaveTowardsForTape, On_Tape}, //Towards_Tower TAPE_CHANGED
+    {NULL, LeaveAtTower, Lost}, //At_Tower DEAD_BOT_DETECTED
+    {NULL, StartTraverse, Traverse_Scan}, //At_Tower BALL_DEPOSITED
+    {NULL, LeaveAtTower, Lost}, //At_Tower LOST_OVER
+    {FrontBumper, BackOffTape, At_Tower}, //On_Tape BUMPERS_CHANGED
+    {NULL, NULL, HSM_NO_STATE}, //On_Tape BUMPERS_CHANGED
+    {NULL, SpinOffTape, Spin_Scan}, //On_Tape ESCAPED_TAPE
+    {FloorTape, SpinLeft, Spin_Scan}, //Lost TAPE_CHANGED
+    {NULL, NULL, HSM_NO_STATE}, //Lost TAPE_CHANGED
+    {FrontBeacon, ApproachTower, Towards_Tower}, //Lost BEACON_CHANGED
+    {FrontBeacon, ApproachFromTraverse, Towards_Tower}, //Traverse_Scan BEACON_CHANGED
+};
+
+static const HSM_Slot_t RobotHSMSlots[ROBOTHSM_NUM_STATES][NUMBEROFEVENTS] = {
+    [InitPState][ES_INIT] = {0, 1},
+    [Set_Up][MANEUVER_OVER] = {1, 1},
+    [Spin_Scan][BEACON_BEARING] = {2, 1},
+    [Spin_Scan][BEACON_CHANGED] = {3, 1},
+    [Towards_Tower][BUMPERS_CHANGED] = {4, 1},
+    [Towards_Tower][TAPE_CHANGED] = {5, 1},
+    [At_Tower][DEAD_BOT_DETECTED] = {6, 1},
+    [At_Tower][BALL_DEPOSITED] = {7, 1},
+    [At_Tower][LOST_OVER] = {8, 1},
+    [On_Tape][BUMPERS_CHANGED] = {9, 2},
+    [On_Tape][ESCAPED_TAPE] = {11, 1},
+    [Lost][TAPE_CHANGED] = {12, 2},
+    [Lost][BEACON_CHANGED] = {14, 1},
+    [Traverse_Scan][BEACON_CHANGED] = {15, 1},
+};
+
+static const HSM_Machine_t RobotHSMMachine = {RobotHSMStates, &RobotHSMSlots[0][0], RobotHSMTransitions};
+
+#endif /* ROBOTHSM_TABLE_H */
@@ -32,11 +32,28 @@
 #include "BOARD.h"
 #include "RobotHSM.h"
 #include "TapeSubState.h"
-#include "Robot.h"
+#include "hsm_engine.h"
+#include "robot.h"
+#include "robot_services.h"
+#include "robot_units.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
+#define TELEM_SOURCE TELEM_SRC_TapeSubState
+#include "telem_trace.h"
+
+//maneuvers end on encoder distance (MOVE_COMPLETE), the distances are what the
+//old 600/350/800 ms timers covered on a fresh pack coming out of the previous
+//maneuver, the timeouts are 1.5x the old times. Each maneuver state starts its
+//move on ES_ENTRY and cancels it on ES_EXIT, so leaving early (a bump, the
+//tape again) leaves nothing running
+#define BACKUP_MM 205
+#define BACKUP_TIMEOUT_MS 900
+#define TURN_DEG 47
+#define TURN_TIMEOUT_MS 525
+#define FORWARD_MM 300
+#define FORWARD_TIMEOUT_MS 1200
 
 typedef enum {
     InitPSubState,
@@ -71,7 +88,6 @@ static const char *StateNames[] = {
  * The type of state variable should match that of enum in header file. */
 
 static TapeSubState_t CurrentState = InitPSubState; // <- change name to match ENUM
-static uint8_t MyPriority;
 static uint8_t last_tape = 0x0;
 
 
@@ -165,7 +181,6 @@ ES_Event RunTapeSubState(ES_Event ThisEvent) {
                         //begin backing up
                         Robot_LeftMtrSpeed(-100);
                         Robot_RightMtrSpeed(-100);
-                        ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 600);
 
                         nextState = BackUp;
                         makeTransition = TRUE;
@@ -176,7 +191,6 @@ ES_Event RunTapeSubState(ES_Event ThisEvent) {
                         Robot_RightMtrSpeed(100);
                         nextState = Forward;
                         makeTransition = TRUE;
-                        ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 800);
 
                         ThisEvent.EventType = ES_NO_EVENT;
                     }
@@ -192,15 +206,16 @@ ES_Event RunTapeSubState(ES_Event ThisEvent) {
             switch (ThisEvent.EventType) {
                 case ES_NO_EVENT:
                     break;
+                case ES_ENTRY:
+                    Motion_Start(Units_MMToTicks(BACKUP_MM), BACKUP_TIMEOUT_MS);
+                    break;
                 case ES_EXIT:
+                    Motion_Cancel();
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
                 case TAPE_CHANGED:
                     //stop backing up and do turn early if tape detected in back
                     if ((BACK_RIGHT_TAPE_MASK & ThisEvent.EventParam) || (BACK_LEFT_TAPE_MASK & ThisEvent.EventParam)) {
-
-                        ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 350); //todo: use rand function here
-
                         if (last_tape & FRONT_LEFT_TAPE_MASK) {
                             Robot_LeftMtrSpeed(75);
                             Robot_RightMtrSpeed(-75);
@@ -217,9 +232,7 @@ ES_Event RunTapeSubState(ES_Event ThisEvent) {
                         ThisEvent.EventType = ES_NO_EVENT;
                     }
                     break;
-                case MANEUVER_OVER:
-                    ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 350);
-
+                case MOVE_COMPLETE:
                     if (last_tape & FRONT_LEFT_TAPE_MASK) {
                         Robot_LeftMtrSpeed(75);
                         Robot_RightMtrSpeed(-75);
@@ -245,7 +258,6 @@ ES_Event RunTapeSubState(ES_Event ThisEvent) {
                             Robot_RightMtrSpeed(75);
                             nextState = RightTurn;
                         }
-                        ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 350);
                         makeTransition = TRUE;
                         ThisEvent.EventType = ES_NO_EVENT;
                         break;
@@ -263,18 +275,21 @@ ES_Event RunTapeSubState(ES_Event ThisEvent) {
             switch (ThisEvent.EventType) {
                 case ES_NO_EVENT:
                     break;
+                case ES_ENTRY:
+                    Motion_Start(Units_TurnDegToTicks(TURN_DEG), TURN_TIMEOUT_MS); //todo: use rand function here
+                    break;
                 case ES_EXIT:
+                    Motion_Cancel();
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
                 case TAPE_CHANGED: //todo: add code to stop and back up again?
                     break;
-                case MANEUVER_OVER:
+                case MOVE_COMPLETE:
 
                     Robot_LeftMtrSpeed(100);
                     Robot_RightMtrSpeed(100);
                     nextState = Forward;
                     makeTransition = TRUE;
-                    ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 800);
 
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
@@ -288,18 +303,21 @@ ES_Event RunTapeSubState(ES_Event ThisEvent) {
             switch (ThisEvent.EventType) {
                 case ES_NO_EVENT:
                     break;
+                case ES_ENTRY:
+                    Motion_Start(Units_TurnDegToTicks(TURN_DEG), TURN_TIMEOUT_MS);
+                    break;
                 case ES_EXIT:
+                    Motion_Cancel();
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
                 case TAPE_CHANGED: //todo: add code to stop and back up again?
                     break;
-                case MANEUVER_OVER:
+                case MOVE_COMPLETE:
 
                     Robot_LeftMtrSpeed(100);
                     Robot_RightMtrSpeed(100);
                     nextState = Forward;
                     makeTransition = TRUE;
-                    ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 800);
 
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
@@ -315,21 +333,25 @@ ES_Event RunTapeSubState(ES_Event ThisEvent) {
             switch (ThisEvent.EventType) {
                 case ES_NO_EVENT:
                     break;
+                case ES_ENTRY:
+                    Motion_Start(Units_MMToTicks(FORWARD_MM), FORWARD_TIMEOUT_MS);
+                    break;
                 case ES_EXIT:
+                    Motion_Cancel();
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
                     //if run into tape again
                 case TAPE_CHANGED:
                     if ((ThisEvent.EventParam & FRONT_LEFT_TAPE_MASK) || (ThisEvent.EventParam & FRONT_RIGHT_TAPE_MASK)) {
                         nextState = SaveTape;
-                        PostRobotHSM(ThisEvent); //repost event for SaveTape state
+                        HSM_Recall(ThisEvent); //SaveTape handles this tape event once it is entered
 
                         makeTransition = TRUE;
                         ThisEvent.EventType = ES_NO_EVENT;
                     }
 
                     break;
-                case MANEUVER_OVER:
+                case MOVE_COMPLETE:
                     //escaped!
                     ThisEvent.EventType = ES_NO_EVENT;
 
@@ -372,6 +394,10 @@ int ResetTapeSubState(void) {
     return 1;
 }
 
+uint8_t QueryTapeSubState(void) {
+    return CurrentState;
+}
+
 /*******************************************************************************
  * PRIVATE FUNCTIONS                                                           *
  ******************************************************************************/
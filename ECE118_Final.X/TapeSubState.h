@@ -72,5 +72,8 @@ ES_Event RunTapeSubState(ES_Event ThisEvent);
 
 
 int ResetTapeSubState(void);
+
+//current state, for the RobotHSM event trace (event_trace.h)
+uint8_t QueryTapeSubState(void);
 #endif /* SUB_HSM_Template_H */
 
@@ -1,8 +1,12 @@
 #include <BOARD.h>
+#ifndef ROBOT_HOST
 #include <xc.h>
+#endif
 #include <stdio.h>
 #include "ES_Configure.h"
 #include "ES_Framework.h"
+#include "robot.h"
+#include "event_trace.h"
 
 void main(void)
 {
@@ -35,6 +39,8 @@ void main(void)
         printf("Other Failure: %d", ErrorType);
         break;
     }
+    printf("\r\n");
+    Trace_Dump(); //what RobotHSM saw last
     for (;;)
         ;
 
@@ -41,6 +41,8 @@
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
+#define TELEM_SOURCE TELEM_SRC_TemplateHSM
+#include "telem_trace.h"
 
 
 typedef enum {
@@ -200,7 +200,7 @@ int beacon_avg() {
     uint16_t sample_sum = 0;
     while (sample_count < 15) {
         //while(!AD_IsNewDataReady(); //replace this with a tiny busy delay if this does not delay enough
-        sample_sum += AD_ReadADPin(BEACON_ADC);
+        sample_sum += Robot_BeaconDetector();
         sample_count++;
         delay(2000);
 
@@ -231,7 +231,7 @@ int beacon_detector_test() {
             }
             delay(200000);
 
-            printf("B%d: %d   \r\n", beacon_select, AD_ReadADPin(BEACON_ADC));
+            printf("B%d: %d   \r\n", beacon_select, Robot_BeaconDetector());
         }
     }
     printf("Beacon Sensor Test Complete\n");
@@ -99,7 +99,7 @@ int beacon_detector_test() {
             }
             delay(200000);
 
-            printf("Beacon %d: %d \n", beacon_select, AD_ReadADPin(BEACON_ADC));
+            printf("Beacon %d: %d \n", beacon_select, Robot_BeaconDetector());
         }
     }
     printf("Beacon Sensor Test Complete\n");
@@ -32,11 +32,13 @@
 #include "BOARD.h"
 #include "RobotHSM.h"
 #include "TowardsTowerSubHSM.h"
-#include "Robot.h"
+#include "robot.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
+#define TELEM_SOURCE TELEM_SRC_TowardsTowerSubHSM
+#include "telem_trace.h"
 
 typedef enum {
     InitPSubState,
@@ -67,8 +69,6 @@ static const char *StateNames[] = {
  * The type of state variable should match that of enum in header file. */
 
 static TowardsTowerSubHSMState_t CurrentState = InitPSubState; // <- change name to match ENUM
-static uint8_t MyPriority;
-static uint8_t last_bumped = 0x0;
 
 
 /*******************************************************************************
@@ -254,6 +254,10 @@ int ResetTowardsTowerSubHSM(void){
     return 1;
 }
 
+uint8_t QueryTowardsTowerSubHSM(void) {
+    return CurrentState;
+}
+
 
 /*******************************************************************************
  * PRIVATE FUNCTIONS                                                           *
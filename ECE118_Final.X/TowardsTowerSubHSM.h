@@ -72,5 +72,8 @@ ES_Event RunTowardsTowerSubHSM(ES_Event ThisEvent);
 
 int ResetTowardsTowerSubHSM(void);
 
+//current state, for the RobotHSM event trace (event_trace.h)
+uint8_t QueryTowardsTowerSubHSM(void);
+
 #endif /* SUB_HSM_Template_H */
 
@@ -32,11 +32,19 @@
 #include "BOARD.h"
 #include "RobotHSM.h"
 #include "TowerAlignSubHSM.h"
-#include "Robot.h"
+#include "hsm_engine.h"
+#include "robot.h"
+#include "robot_services.h"
+#include "robot_units.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
+#define TELEM_SOURCE TELEM_SRC_TowerAlignSubHSM
+#include "telem_trace.h"
+
+#define REVERSE_MM 110 //back off the tower after a bump, what the old 350 ms covered on a fresh pack
+#define REVERSE_TIMEOUT_MS 525
 #define TIMEOUT 20000
 
 typedef enum {
@@ -82,7 +90,6 @@ static const char *StateNames[] = {
  * The type of state variable should match that of enum in header file. */
 
 static TowerAlignSubHSMState_t CurrentState = InitPSubState; // <- change name to match ENUM
-static uint8_t MyPriority;
 static uint8_t last_bumped = 0x0;
 
 /*******************************************************************************
@@ -150,10 +157,16 @@ ES_Event RunTowerAlignSubHSM(ES_Event ThisEvent) {
             switch (ThisEvent.EventType) {
                 case ES_NO_EVENT:
                     break;
+                case ES_ENTRY: //entered with At_Tower, RobotHSM's AtTowerEntry then replaces this with its back off
+                    if (!HSM_Initializing()) { //StartMatch's init of the sub HSMs enters Adjust too, nothing to move yet
+                        Motion_Start(Units_MMToTicks(REVERSE_MM), REVERSE_TIMEOUT_MS);
+                    }
+                    break;
                 case ES_EXIT:
+                    Motion_Cancel();
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
-                case MANEUVER_OVER:
+                case MOVE_COMPLETE:
 
                     //todo: remove use of ==, change order of if statements to work with &
                     if ((FRONT_RIGHT_BMP_MASK | FRONT_LEFT_BMP_MASK) & last_bumped) { //todo: change to bitwise and and fix logic. leaving unchanged for now bc seems to be working
@@ -201,7 +214,6 @@ ES_Event RunTowerAlignSubHSM(ES_Event ThisEvent) {
                 case BUMPERS_CHANGED:
                     Robot_LeftMtrSpeed(-100);
                     Robot_RightMtrSpeed(-100);
-                    ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 350);
 
                     nextState = Adjust;
                     makeTransition = TRUE;
@@ -3,9 +3,16 @@
 #include "BOARD.h"
 #include "RobotHSM.h"
 #include "TowerShootSubHSM.h"
-#include "Robot.h"
+#include "robot.h"
+#include "robot_services.h"
+#include "robot_units.h"
 
 #define SHOOT_INITSTATE Scoring
+#define TELEM_SOURCE TELEM_SRC_TowerShootSubHSM
+#include "telem_trace.h"
+
+#define JIGGLE_MM 30 //each shake after the shot, about what the old 150 ms covered reversing on a fresh pack
+#define JIGGLE_TIMEOUT_MS 225
 
 typedef enum {
     InitPSubState,
@@ -43,8 +50,6 @@ void Forward(void);
  * The type of state variable should match that of enum in header file. */
 
 static TowerShootSub_t CurrentState = InitPSubState; // <- change name to match ENUM
-static uint8_t MyPriority;
-static uint8_t last_tape = 0x0;
 static int jig = 0;
 
 
@@ -245,7 +250,6 @@ ES_Event RunTowerShootSubHSM(ES_Event ThisEvent) {
                 case MANEUVER_OVER:
                     Robot_LeftMtrSpeed(-90);
                     Robot_RightMtrSpeed(-90);
-                    ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 150);
                     nextState = Jiggle;
                     jig++;
                     makeTransition = TRUE;
@@ -258,7 +262,11 @@ ES_Event RunTowerShootSubHSM(ES_Event ThisEvent) {
                     break;
 
                 case WAIT_OVER:
-                    Robot_SolenoidPopBall();
+                    Robot_SolenoidPopBall(); //one ball per shot, nothing tells us it jammed
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+
+                case BALL_FIRED: //keep waiting for MANEUVER_OVER, the pulse is well inside it
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
                     
@@ -271,11 +279,15 @@ ES_Event RunTowerShootSubHSM(ES_Event ThisEvent) {
             switch (ThisEvent.EventType) {
                 case ES_NO_EVENT:
                     break;
+                case ES_ENTRY:
+                    Motion_Start(Units_MMToTicks(JIGGLE_MM), JIGGLE_TIMEOUT_MS);
+                    break;
                 case ES_EXIT:
+                    Motion_Cancel();
                     ThisEvent.EventType = ES_NO_EVENT;
                     break;
 
-                case MANEUVER_OVER:
+                case MOVE_COMPLETE:
                     if (jig == 3) {
                         ThisEvent.EventType = ES_NO_EVENT;
                         ES_Event newEvent;
@@ -286,13 +298,13 @@ ES_Event RunTowerShootSubHSM(ES_Event ThisEvent) {
                     } else if (jig % 2 == 0){
                         Robot_LeftMtrSpeed(-80);
                         Robot_RightMtrSpeed(-80);
-                        ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 150);
+                        Motion_Start(Units_MMToTicks(JIGGLE_MM), JIGGLE_TIMEOUT_MS);
                         jig++;
                         ThisEvent.EventType = ES_NO_EVENT;
                     } else {
                         Robot_LeftMtrSpeed(80);
                         Robot_RightMtrSpeed(80);
-                        ES_Timer_InitTimer(MANEUVER_SERVICE_TIMER, 150);
+                        Motion_Start(Units_MMToTicks(JIGGLE_MM), JIGGLE_TIMEOUT_MS);
                         jig++;
                         ThisEvent.EventType = ES_NO_EVENT;
                     }
@@ -32,11 +32,14 @@
 #include "BOARD.h"
 #include "RobotHSM.h"
 #include "TowerTraverseSubHSM.h"
-#include "Robot.h"
+#include "robot.h"
+#include "stdio.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
+#define TELEM_SOURCE TELEM_SRC_TowerTraverseSubHSM
+#include "telem_trace.h"
 #define CORNERTIME 90
 #define TIMEOUT 20000
 
@@ -79,8 +82,6 @@ ES_Event newEvent;
  * The type of state variable should match that of enum in header file. */
 
 static TowerTraverseSubHSMState_t CurrentState = InitPSubState; // <- change name to match ENUM
-static uint8_t MyPriority;
-static uint8_t last_bumped = 0x0;
 static uint8_t Count = 0;
 
 /*******************************************************************************
@@ -469,3 +470,7 @@ int ResetTowerTraverseSubHSM(void) {
     Count = 0;
     return 1;
 }
+
+uint8_t QueryTowerTraverseSubHSM(void) {
+    return CurrentState;
+}
@@ -71,5 +71,8 @@ uint8_t InitTowerTraverseSubHSM(void);
 ES_Event RunTowerTraverseSubHSM(ES_Event ThisEvent);
 int ResetTowerTraverseSubHSM(void);
 
+//current state, for the RobotHSM event trace (event_trace.h)
+uint8_t QueryTowerTraverseSubHSM(void);
+
 #endif /* SUB_HSM_Template_H */
 
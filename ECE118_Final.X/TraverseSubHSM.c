@@ -32,11 +32,13 @@
 #include "BOARD.h"
 #include "RobotHSM.h"
 #include "TraverseSubHSM.h"
-#include "Robot.h"
+#include "robot.h"
 
 /*******************************************************************************
  * MODULE #DEFINES                                                             *
  ******************************************************************************/
+#define TELEM_SOURCE TELEM_SRC_TraverseSubHSM
+#include "telem_trace.h"
 #define CORNERTIME 2000
 #define LOSTTIME 10000
 
@@ -71,8 +73,6 @@ static const char *StateNames[] = {
  * The type of state variable should match that of enum in header file. */
 
 static AtTowerSubHSMState_t CurrentState = InitPSubState; // <- change name to match ENUM
-static uint8_t MyPriority;
-static uint8_t last_bumped = 0x0;
 
 /*******************************************************************************
  * PUBLIC FUNCTIONS                                                            *
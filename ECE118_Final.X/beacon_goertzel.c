@@ -0,0 +1,100 @@
+/*
+ * File:   beacon_goertzel.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include "beacon_goertzel.h"
+
+uint32_t Goertzel_Amplitude2(const int16_t *samples, uint16_t n, int16_t coeff) {
+    int32_t mean = 0;
+    int32_t s0;
+    int32_t s1 = 0;
+    int32_t s2 = 0;
+    int64_t power;
+    uint16_t i;
+
+    if (0 == n) {
+        return 0;
+    }
+
+    //remove the DC first, keeps the filter state small for 10 bit input
+    for (i = 0; i < n; i++) {
+        mean += samples[i];
+    }
+    mean /= n;
+
+    for (i = 0; i < n; i++) {
+        s0 = (samples[i] - mean) + ((coeff * s1) >> GOERTZEL_Q) - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+
+    //|X|^2 = s1^2 + s2^2 - coeff * s1 * s2, and the amplitude is 2|X| / n
+    power = (int64_t) s1 * s1 + (int64_t) s2 * s2 - (((int64_t) coeff * s1 * s2) >> GOERTZEL_Q);
+    if (power < 0) {
+        power = 0; //rounding on an empty bin
+    }
+    return (uint32_t) (power * 4 / ((uint32_t) n * n));
+}
+
+/*
+ * Host test harness, synthesizes blocks with the tone, DC offsets, off
+ * frequency interference and noise and prints the estimated amplitude:
+ *
+ *   gcc -DGOERTZEL_TEST -o goertzel_test beacon_goertzel.c -lm
+ */
+#ifdef GOERTZEL_TEST
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define TEST_FS 10000.0
+
+static void MakeBlock(int16_t *block, double dc, double amp, double hz, double other_amp, double other_hz, int noise) {
+    int i;
+    for (i = 0; i < BEACON_BLOCK_LEN; i++) {
+        double t = i / TEST_FS;
+        double v = dc + amp * sin(2 * M_PI * hz * t + 0.3) + other_amp * sin(2 * M_PI * other_hz * t);
+        if (noise) {
+            v += (rand() % (2 * noise + 1)) - noise;
+        }
+        if (v < 0) v = 0;
+        if (v > 1023) v = 1023;
+        block[i] = (int16_t) lround(v);
+    }
+}
+
+static int Check(const char *name, double dc, double amp, double hz, double other_amp, double other_hz, int noise, int expect) {
+    int16_t block[BEACON_BLOCK_LEN];
+    uint32_t a2;
+    int detected;
+
+    MakeBlock(block, dc, amp, hz, other_amp, other_hz, noise);
+    a2 = Goertzel_Amplitude2(block, BEACON_BLOCK_LEN, BEACON_GOERTZEL_COEFF);
+    detected = (a2 > (uint32_t) BEACON_UPPER_AMPLITUDE * BEACON_UPPER_AMPLITUDE);
+    printf("%-40s amplitude %6.1f  %s%s\n", name, sqrt(a2), detected ? "DETECTED" : "-",
+            (detected == expect) ? "" : "   <-- FAIL");
+    return (detected == expect);
+}
+
+int main(void) {
+    int ok = 1;
+
+    srand(1);
+    ok &= Check("no beacon, dark", 20, 0, 2000, 0, 0, 4, 0);
+    ok &= Check("no beacon, bright ambient (DC 900)", 900, 0, 2000, 0, 0, 8, 0);
+    ok &= Check("no beacon, 1 kHz interference 200", 512, 0, 2000, 200, 1000, 8, 0);
+    ok &= Check("no beacon, 3 kHz interference 200", 512, 0, 2000, 200, 3000, 8, 0);
+    ok &= Check("no beacon, 100 Hz flicker 300", 512, 0, 2000, 300, 100, 8, 0);
+    ok &= Check("weak beacon 60", 512, 60, 2000, 0, 0, 8, 0);
+    ok &= Check("beacon 150", 512, 150, 2000, 0, 0, 8, 1);
+    ok &= Check("beacon 150 on DC 100", 100, 150, 2000, 0, 0, 8, 1);
+    ok &= Check("beacon 150, noise +-50", 512, 150, 2000, 0, 0, 50, 1);
+    ok &= Check("beacon 300 + 100 Hz flicker 150", 512, 300, 2000, 150, 100, 8, 1);
+    ok &= Check("beacon 400 (full swing)", 512, 400, 2000, 0, 0, 8, 1);
+
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+#endif
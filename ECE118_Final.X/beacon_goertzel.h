@@ -0,0 +1,37 @@
+/* 
+ * File:   beacon_goertzel.h
+ *
+ * Fixed point Goertzel (single bin DFT) detector for the beacon tone. Works on
+ * a block of raw BEACON_ADC samples taken at HAL_BEACON_SAMPLE_HZ and returns
+ * the squared amplitude of the HAL_BEACON_TONE_HZ component, so the DC level
+ * (ambient IR, detector offset) drops out. Pure functions, no hardware access,
+ * build with GOERTZEL_TEST defined for the host test harness at the bottom of
+ * beacon_goertzel.c.
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef BEACON_GOERTZEL_H
+#define	BEACON_GOERTZEL_H
+
+#include <stdint.h>
+
+/*** MACROS ***/
+#define GOERTZEL_Q 14 //coefficient fraction bits
+
+//50 samples at 10 kHz is 5 ms, exactly 10 periods of the 2 kHz tone so the
+//bin sits right on the tone and DC has no leakage into it
+#define BEACON_BLOCK_LEN 50
+#define BEACON_GOERTZEL_COEFF 10126 //2 * cos(2 * pi * 2000 / 10000) in Q14
+
+//detection hysteresis on the tone amplitude, in ADC counts
+#define BEACON_UPPER_AMPLITUDE 120
+#define BEACON_LOWER_AMPLITUDE 80
+
+/*** Function Headers ***/
+
+//squared amplitude (ADC counts^2) of the tone picked by coeff in samples[0..n-1],
+//coeff is 2 * cos(2 * pi * f / fs) in Q14
+uint32_t Goertzel_Amplitude2(const int16_t *samples, uint16_t n, int16_t coeff);
+
+#endif	/* BEACON_GOERTZEL_H */
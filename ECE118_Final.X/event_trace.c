@@ -0,0 +1,68 @@
+/*
+ * File:   event_trace.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include <stdio.h>
+#include "ES_Configure.h"
+#include "ES_Timers.h"
+#include "robot.h"
+#include "event_trace.h"
+
+/*** MACROS ***/
+#if (TRACE_DEPTH & (TRACE_DEPTH - 1)) != 0
+#error "TRACE_DEPTH has to be a power of 2"
+#endif
+
+/*** Module Variables ***/
+static Trace_Record_t Ring[TRACE_DEPTH];
+static uint32_t Total;
+
+/*** Public Functions ***/
+
+void Trace_Record(const ES_Event *ThisEvent, uint8_t state, uint8_t sub, uint8_t next, uint8_t next_sub) {
+    Trace_Record_t *r = &Ring[Total & (TRACE_DEPTH - 1)];
+
+    r->time = ES_Timer_GetTime();
+    r->param = ThisEvent->EventParam;
+    r->type = ThisEvent->EventType;
+    r->state = state;
+    r->sub = sub;
+    r->next = next;
+    r->next_sub = next_sub;
+    r->tape = Robot_ReadTape();
+    r->bumpers = Robot_ReadBumpers();
+    Total++;
+}
+
+uint16_t Trace_Count(void) {
+    return (Total < TRACE_DEPTH) ? Total : TRACE_DEPTH;
+}
+
+uint32_t Trace_Total(void) {
+    return Total;
+}
+
+const Trace_Record_t *Trace_Get(uint16_t index) {
+    if (index >= Trace_Count()) {
+        return NULL;
+    }
+    return &Ring[(Total - Trace_Count() + index) & (TRACE_DEPTH - 1)];
+}
+
+void Trace_Dump(void) {
+    uint16_t i;
+
+    printf("TRACE %u %lu\n", Trace_Count(), (unsigned long) (Total - Trace_Count()));
+    for (i = 0; i < Trace_Count(); i++) {
+        const Trace_Record_t *r = Trace_Get(i);
+        printf("%lu,%u,%u,%u,%u,%u,%u,%u,%u\n", (unsigned long) r->time, r->type, r->param, r->state, r->sub,
+                r->next, r->next_sub, r->tape, r->bumpers);
+    }
+    printf("TRACE END\n");
+}
+
+void Trace_Reset(void) {
+    Total = 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * File:   event_trace.h
+ *
+ * Flight recorder for RobotHSM. RunRobotHSM records every event it is handed,
+ * with the time, the state and sub state it found the machine in, the ones it
+ * left it in and the raw tape/bumper pins, into a ring of the last TRACE_DEPTH
+ * events. Trace_Dump prints the ring as text on the serial port (profiler key
+ * PROF_TRACE_KEY, or after ES_Run fails), and host/trace_replay feeds such a
+ * dump back into the host build of RobotHSM and checks that it walks through
+ * the same states.
+ *
+ * Replay starts RobotHSM from its initial state, so it needs a dump that still
+ * holds the ES_INIT of the match, i.e. one taken within TRACE_DEPTH events of
+ * the reset. The host build raises TRACE_DEPTH to hold a whole match.
+ *
+ * Dump format, one record per line, all decimal:
+ *
+ *   TRACE <records> <sequence number of the first record>
+ *   <time_ms>,<type>,<param>,<state>,<sub>,<next>,<next_sub>,<tape>,<bumpers>
+ *   ...
+ *   TRACE END
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef EVENT_TRACE_H
+#define	EVENT_TRACE_H
+
+#include "ES_Configure.h"
+#include "ES_Events.h"
+
+/*** Macros ***/
+#ifndef TRACE_DEPTH
+#define TRACE_DEPTH 128 //records, 16 bytes each, power of 2
+#endif
+
+/*** Typedefs ***/
+typedef struct {
+    uint32_t time; //ES_Timer_GetTime() ms
+    uint16_t param;
+    uint8_t type;
+    uint8_t state; //RobotHSM state the event found
+    uint8_t sub; //its sub machine's state, HSM_NO_STATE if none
+    uint8_t next; //RobotHSM state after the event
+    uint8_t next_sub;
+    uint8_t tape; //Robot_ReadTape(), before the filter
+    uint8_t bumpers; //Robot_ReadBumpers(), before the debounce
+} Trace_Record_t;
+
+/*** Function Headers ***/
+void Trace_Record(const ES_Event *ThisEvent, uint8_t state, uint8_t sub, uint8_t next, uint8_t next_sub);
+uint16_t Trace_Count(void); //records held, up to TRACE_DEPTH
+uint32_t Trace_Total(void); //records ever made
+const Trace_Record_t *Trace_Get(uint16_t index); //0 is the oldest held
+void Trace_Dump(void); //prints the ring with printf
+void Trace_Reset(void);
+
+#endif	/* EVENT_TRACE_H */
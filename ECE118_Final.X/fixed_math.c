@@ -0,0 +1,75 @@
+/*
+ * File:   fixed_math.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include "fixed_math.h"
+
+/*** MACROS ***/
+#define SIN_TABLE_BITS 6 //quarter wave table has 2^6 steps
+#define SIN_FRAC_BITS (14 - SIN_TABLE_BITS) //angle bits left over for interpolation
+
+/*** Module Variables ***/
+//sin(i * 90 deg / 64) in Q16, one extra entry so interpolation never reads past the end
+static const int32_t SinTable[(1 << SIN_TABLE_BITS) + 1] = {
+    0, 1608, 3216, 4821, 6424, 8022, 9616, 11204,
+    12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+    25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062,
+    36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+    46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581,
+    54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+    60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944,
+    64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+    65536
+};
+
+int32_t Fix_SinQ16(uint16_t angle) {
+    uint16_t quarter = angle & (ANGLE_90_DEG - 1);
+    uint16_t index;
+    int32_t frac;
+    int32_t result;
+
+    //mirror the 2nd and 4th quadrants back onto the first
+    if (angle & ANGLE_90_DEG) {
+        quarter = ANGLE_90_DEG - quarter;
+    }
+    index = quarter >> SIN_FRAC_BITS;
+    frac = quarter & ((1 << SIN_FRAC_BITS) - 1);
+
+    //linear interpolation between table entries (index 64 only hit at exactly 90 deg)
+    result = SinTable[index];
+    if (frac) {
+        result += ((SinTable[index + 1] - result) * frac) >> SIN_FRAC_BITS;
+    }
+
+    //negative half of the turn
+    if (angle & ANGLE_180_DEG) {
+        result = -result;
+    }
+    return result;
+}
+
+int32_t Fix_CosQ16(uint16_t angle) {
+    return Fix_SinQ16(angle + ANGLE_90_DEG);
+}
+
+//bit by bit, 16 iterations of shifts and adds, no multiply or divide
+uint16_t Fix_Sqrt32(uint32_t x) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (x >= root + bit) {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t) root;
+}
@@ -0,0 +1,26 @@
+/* 
+ * File:   fixed_math.h
+ *
+ * Fixed point helpers for the PIC32MX, which has no FPU. Angles are binary
+ * angles (65536 = one full turn), results are Q16 (65536 = 1.0).
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef FIXED_MATH_H
+#define	FIXED_MATH_H
+
+#include <stdint.h>
+
+#define Q16_ONE 65536
+#define ANGLE_90_DEG 0x4000 //binary angle, 65536 = 360 deg
+#define ANGLE_180_DEG 0x8000
+
+#define ANGLE_TO_DEG(a) (((int32_t) (int16_t) (a) * 360) >> 16) //-180 to 179
+#define DEG_TO_ANGLE(d) ((uint16_t) ((int32_t) (d) * 65536 / 360))
+
+int32_t Fix_SinQ16(uint16_t angle); //sin of a binary angle in Q16, from a lookup table
+int32_t Fix_CosQ16(uint16_t angle); //cos of a binary angle in Q16, from a lookup table
+uint16_t Fix_Sqrt32(uint32_t x); //integer square root, rounded down
+
+#endif	/* FIXED_MATH_H */
@@ -0,0 +1,622 @@
+/*
+ * File:   ArenaSim.c
+ *
+ * Host arena simulator, see ArenaSim.h. Physics runs at a fixed SIM_STEP_US
+ * regardless of how the ES loop slices time, the event loop only ever sees the
+ * latched HAL inputs, exactly like it only sees port bits on the PIC32.
+ *
+ * Collisions are resolved by pushing the body back out of walls and towers, so
+ * the bot slides along a tower face while it is steering into it (that is how
+ * the traverse sub-HSMs keep the side bumpers closed). The wheels keep turning
+ * while the body is blocked, so the encoders slip just like the real ones.
+ *
+ * Created on October 17, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "robot.h"
+#include "robot_hal.h"
+#include "fixed_math.h"
+#include "ArenaSim.h"
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+#define SIM_BUMPER_TRAVEL_MM 6 //how far past the body a bumper closes
+
+//floor tape sensors (robot frame, mm), order matches the *_TAPE_MASK bits
+#define SIM_TAPE_FWD_MM 110
+#define SIM_TAPE_SIDE_MM 90
+
+//side tape and track wire sensors look out of the left side at the tower face,
+//the tape sensors see the hole tape from the body edge out to this far
+#define SIM_SIDE_TAPE_RANGE_MM 45
+#define SIM_SIDE_TAPE_SPAN_MM 60 //side tape sensors at +/- this along the body
+#define SIM_HOLE_TAPE_HALF_MM 90 //tape patch around the scoring hole
+#define SIM_TRACK_WIRE_SPAN_MM 50
+#define SIM_TRACK_WIRE_RANGE_MM 70
+
+//analog levels, chosen around the old fixed track wire band (540/580, see trackwire_cal.h) and the
+//thresholds in beacon_goertzel.h
+#define SIM_BEACON_FOV_DEG 7 //half angle where the detector trips (40% of SIM_BEACON_TONE)
+#define SIM_BEACON_LOBE_DEG 12 //main lobe falls off linearly to 0 here
+#define SIM_BEACON_SIDE_LOBE 0.25 //wide lobe, cos(angle) times this, under the detection threshold
+#define SIM_BEACON_RANGE_MM 3000
+#define SIM_BEACON_DC 512 //detector output sits mid scale, the beacon is the tone on top
+#define SIM_BEACON_TONE 300 //tone amplitude with a beacon in view, see beacon_goertzel.h
+#define SIM_TRACK_WIRE_HIGH 640
+#define SIM_TRACK_WIRE_LOW 420
+#define SIM_ADC_NOISE 24 //peak to peak
+
+#define SIM_LEFT_MTR_GAIN 1.05 //left motor is the stronger one (see Robot_LeftMtrSpeed)
+#define SIM_BATTERY_NOMINAL 700
+#define SIM_BATTERY_DRAIN_MS 120000 //one match
+
+#define SIM_PUSHOUT_PASSES 3
+
+#define DEG_TO_RAD(d) ((d) * M_PI / 180.0)
+#define RAD_TO_DEG(r) ((r) * 180.0 / M_PI)
+
+/*******************************************************************************
+ * PRIVATE TYPEDEFS                                                            *
+ ******************************************************************************/
+typedef struct {
+    double x;
+    double y;
+} SimPoint_t;
+
+typedef struct {
+    SimPoint_t center;
+    uint8_t hole_face; //0 = +x, 1 = +y, 2 = -x, 3 = -y, scoring hole + track wire
+} SimTower_t;
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+static const SimTower_t Towers[SIM_NUM_TOWERS] = {
+    {{1200.0, 1200.0}, 1},
+    {{1900.0, 500.0}, 2},
+};
+
+static const SimPoint_t TapeSensors[5] = {
+    {SIM_TAPE_FWD_MM, SIM_TAPE_SIDE_MM}, //front left
+    {SIM_TAPE_FWD_MM, -SIM_TAPE_SIDE_MM}, //front right
+    {SIM_TAPE_FWD_MM + 10, 0}, //front center
+    {-SIM_TAPE_FWD_MM, SIM_TAPE_SIDE_MM}, //back left
+    {-SIM_TAPE_FWD_MM, -SIM_TAPE_SIDE_MM}, //back right
+};
+
+//each bumper covers half of one side of the body, sampled at a few points
+#define PROBE (SIM_BODY_HALF_MM + SIM_BUMPER_TRAVEL_MM)
+#define PROBES_PER_BUMPER 3
+static const SimPoint_t BumperProbes[6][PROBES_PER_BUMPER] = {
+    {{PROBE, 15}, {PROBE, 70}, {PROBE, 125}}, //front left
+    {{PROBE, -15}, {PROBE, -70}, {PROBE, -125}}, //front right
+    {{-PROBE, 15}, {-PROBE, 70}, {-PROBE, 125}}, //back left
+    {{-PROBE, -15}, {-PROBE, -70}, {-PROBE, -125}}, //back right
+    {{-15, PROBE}, {-70, PROBE}, {-125, PROBE}}, //side back (left side)
+    {{15, PROBE}, {70, PROBE}, {125, PROBE}}, //side front (left side)
+};
+
+static const SimPoint_t BodyPoints[8] = {
+    {SIM_BODY_HALF_MM, SIM_BODY_HALF_MM}, {SIM_BODY_HALF_MM, 0},
+    {SIM_BODY_HALF_MM, -SIM_BODY_HALF_MM}, {0, -SIM_BODY_HALF_MM},
+    {-SIM_BODY_HALF_MM, -SIM_BODY_HALF_MM}, {-SIM_BODY_HALF_MM, 0},
+    {-SIM_BODY_HALF_MM, SIM_BODY_HALF_MM}, {0, SIM_BODY_HALF_MM},
+};
+
+//quadrature phase for count & 3, incrementing walks 00 -> 10 -> 11 -> 01
+static const uint8_t QuadPhase[4] = {0x0, 0x2, 0x3, 0x1};
+
+static double pose_x = 400.0;
+static double pose_y = 1200.0;
+static double pose_theta = M_PI / 2;
+static double pose_cos, pose_sin; //cached for ToWorld, refreshed every step
+static double start_x, start_y, start_theta; //odometry origin, for the report
+static double wheel_v[HAL_NUM_MTRS]; //mm/s
+static double wheel_dist[HAL_NUM_MTRS]; //mm turned by each wheel, slip included
+static int32_t wheel_ticks[HAL_NUM_MTRS]; //last quadrature count put on the pins
+static uint32_t step_accum_us;
+static uint64_t sim_time_us;
+static uint32_t rng_state = 1;
+static uint8_t near_obstacle;
+
+static uint32_t log_period_ms;
+static uint32_t next_log_ms;
+static uint32_t burst_period_ms;
+static double tape_edge_mm;
+static int32_t battery_end; //0 = no drain
+static uint16_t track_wire_low = SIM_TRACK_WIRE_LOW;
+static uint16_t track_wire_high = SIM_TRACK_WIRE_HIGH;
+static FILE *track_wire_log;
+
+static uint8_t last_solenoid;
+static uint8_t last_bumpers;
+static uint16_t last_tape;
+
+//match statistics for the report
+static uint32_t num_bumps;
+static uint32_t num_tape_hits;
+static uint32_t num_shots;
+static uint32_t num_scored;
+static int32_t first_beacon_ms = -1;
+static int32_t first_tower_ms = -1;
+static int32_t first_wire_ms = -1;
+static int32_t first_score_ms = -1;
+static struct timespec wall_start;
+
+/*******************************************************************************
+ * PRIVATE FUNCTIONS                                                           *
+ ******************************************************************************/
+
+static uint32_t SimRand(void) {
+    //xorshift32, deterministic across hosts
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint16_t SimAnalog(uint16_t level) {
+    return level + (SimRand() % SIM_ADC_NOISE) - (SIM_ADC_NOISE / 2);
+}
+
+static SimPoint_t ToWorld(SimPoint_t p) {
+    SimPoint_t w = {pose_x + p.x * pose_cos - p.y * pose_sin, pose_y + p.x * pose_sin + p.y * pose_cos};
+    return w;
+}
+
+static int32_t SimMillis(void) {
+    return (int32_t) (sim_time_us / 1000);
+}
+
+//tower face axis helpers, face normal points out of the tower
+static SimPoint_t FaceNormal(uint8_t face) {
+    static const SimPoint_t normals[4] = {{1, 0}, {0, 1}, {-1, 0}, {0, -1}};
+    return normals[face & 0x3];
+}
+
+//returns the push needed to move p out of any obstacle, {0, 0} if free
+static SimPoint_t Penetration(SimPoint_t p) {
+    SimPoint_t push = {0.0, 0.0};
+    uint8_t i;
+
+    //arena walls
+    if (p.x < 0) push.x = -p.x;
+    if (p.x > SIM_ARENA_MM) push.x = SIM_ARENA_MM - p.x;
+    if (p.y < 0) push.y = -p.y;
+    if (p.y > SIM_ARENA_MM) push.y = SIM_ARENA_MM - p.y;
+
+    for (i = 0; i < SIM_NUM_TOWERS; i++) {
+        double dx = p.x - Towers[i].center.x;
+        double dy = p.y - Towers[i].center.y;
+        if ((fabs(dx) < SIM_TOWER_HALF_MM) && (fabs(dy) < SIM_TOWER_HALF_MM)) {
+            double px = (dx > 0 ? SIM_TOWER_HALF_MM : -SIM_TOWER_HALF_MM) - dx;
+            double py = (dy > 0 ? SIM_TOWER_HALF_MM : -SIM_TOWER_HALF_MM) - dy;
+            if (fabs(px) < fabs(py)) {
+                push.x = px;
+            } else {
+                push.y = py;
+            }
+        }
+    }
+    return push;
+}
+
+static uint8_t InObstacle(SimPoint_t p) {
+    SimPoint_t push = Penetration(p);
+    return (push.x != 0.0) || (push.y != 0.0);
+}
+
+//cheap test so the collision and bumper checks only run close to something
+static uint8_t NearObstacle(void) {
+    const double reach = 1.5 * SIM_BODY_HALF_MM + SIM_BUMPER_TRAVEL_MM; //covers the corners
+    uint8_t i;
+
+    if ((pose_x < reach) || (pose_y < reach) || (pose_x > SIM_ARENA_MM - reach) || (pose_y > SIM_ARENA_MM - reach)) {
+        return TRUE;
+    }
+    for (i = 0; i < SIM_NUM_TOWERS; i++) {
+        if ((fabs(pose_x - Towers[i].center.x) < SIM_TOWER_HALF_MM + reach)
+                && (fabs(pose_y - Towers[i].center.y) < SIM_TOWER_HALF_MM + reach)) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+//distance to the nearest wall decides if we are over the perimeter band
+static double WallDistance(SimPoint_t p) {
+    double d = p.x;
+
+    if (p.y < d) d = p.y;
+    if (SIM_ARENA_MM - p.x < d) d = SIM_ARENA_MM - p.x;
+    if (SIM_ARENA_MM - p.y < d) d = SIM_ARENA_MM - p.y;
+    return d;
+}
+
+static uint8_t OnFloorTape(SimPoint_t p) {
+    double d = WallDistance(p);
+    return (d >= SIM_TAPE_INSET_MM) && (d <= SIM_TAPE_INSET_MM + SIM_TAPE_WIDTH_MM);
+}
+
+//within tape_edge_mm of either edge of the perimeter band
+static uint8_t OnFloorTapeEdge(SimPoint_t p) {
+    double d = WallDistance(p);
+    return (fabs(d - SIM_TAPE_INSET_MM) < tape_edge_mm)
+            || (fabs(d - (SIM_TAPE_INSET_MM + SIM_TAPE_WIDTH_MM)) < tape_edge_mm);
+}
+
+//position of p relative to the hole face of tower i: along = offset along the
+//face from its center, out = distance out from the face (negative is inside)
+static void FaceCoords(uint8_t i, SimPoint_t p, double *along, double *out) {
+    SimPoint_t n = FaceNormal(Towers[i].hole_face);
+    double dx = p.x - Towers[i].center.x;
+    double dy = p.y - Towers[i].center.y;
+
+    *out = dx * n.x + dy * n.y - SIM_TOWER_HALF_MM;
+    *along = -dx * n.y + dy * n.x;
+}
+
+static uint8_t OnHoleTape(SimPoint_t p) {
+    uint8_t i;
+    double along, out;
+
+    for (i = 0; i < SIM_NUM_TOWERS; i++) {
+        FaceCoords(i, p, &along, &out);
+        if ((out >= 0) && (out < SIM_SIDE_TAPE_RANGE_MM) && (fabs(along) < SIM_HOLE_TAPE_HALF_MM)) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static uint8_t NearTrackWire(SimPoint_t p) {
+    uint8_t i;
+    double along, out;
+
+    for (i = 0; i < SIM_NUM_TOWERS; i++) {
+        FaceCoords(i, p, &along, &out);
+        if ((out >= 0) && (out < SIM_TRACK_WIRE_RANGE_MM) && (fabs(along) < SIM_TOWER_HALF_MM)) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+//tone amplitude at each beacon detector (left, front, right), returns bit i
+//set if detector i has a tower within SIM_BEACON_FOV_DEG of its axis. Each
+//detector has a narrow main lobe plus a weak wide one, so a tower between two
+//detectors still shows up on both and CheckBeacon can estimate its bearing.
+//Runs every step, so it works on the cosine of the angle off each axis (the
+//tower direction in the robot frame dotted with the axis) and only takes the
+//angle itself inside the main lobe
+static uint8_t BeaconTones(uint16_t *tone) {
+    const double cos_lobe = cos(DEG_TO_RAD(SIM_BEACON_LOBE_DEG));
+    const double cos_fov = cos(DEG_TO_RAD(SIM_BEACON_FOV_DEG));
+    uint8_t view = 0;
+    uint8_t i, d;
+
+    for (d = 0; d < HAL_NUM_BEACONS; d++) {
+        tone[d] = 0;
+    }
+    for (i = 0; i < SIM_NUM_TOWERS; i++) {
+        double dx = Towers[i].center.x - pose_x;
+        double dy = Towers[i].center.y - pose_y;
+        double dist2 = dx * dx + dy * dy;
+        double fwd, left;
+        double cos_off[HAL_NUM_BEACONS];
+
+        if ((dist2 > (double) SIM_BEACON_RANGE_MM * SIM_BEACON_RANGE_MM) || (dist2 == 0)) {
+            continue;
+        }
+        fwd = (dx * pose_cos + dy * pose_sin) / sqrt(dist2);
+        left = (-dx * pose_sin + dy * pose_cos) / sqrt(dist2);
+        cos_off[0] = left; //axis +90 deg
+        cos_off[1] = fwd; //axis 0
+        cos_off[2] = -left; //axis -90 deg
+        for (d = 0; d < HAL_NUM_BEACONS; d++) {
+            double gain = SIM_BEACON_SIDE_LOBE * cos_off[d];
+            uint16_t amplitude;
+
+            if (cos_off[d] > cos_lobe) {
+                double off = acos(fmin(cos_off[d], 1.0));
+                gain = fmax(gain, 1.0 - off / DEG_TO_RAD(SIM_BEACON_LOBE_DEG));
+            }
+            amplitude = (gain > 0) ? (uint16_t) (SIM_BEACON_TONE * gain) : 0;
+            if (amplitude > tone[d]) {
+                tone[d] = amplitude;
+            }
+            if (cos_off[d] > cos_fov) {
+                view |= (1 << d);
+            }
+        }
+    }
+    return view;
+}
+
+static void UpdateMotion(double dt) {
+    double battery = (double) Robot_BatteryVoltage() / SIM_BATTERY_NOMINAL;
+    double alpha = dt / (SIM_MOTOR_TAU_MS / 1000.0);
+    double dl, dr, ds, dtheta;
+    uint8_t m, pass, k;
+
+    for (m = 0; m < HAL_NUM_MTRS; m++) {
+        double target = HAL_HostGetMotor(m) * (SIM_MAX_WHEEL_MM_S / (double) HAL_MAX_DUTY) * battery;
+        if (HAL_LEFT_MTR == m) {
+            target *= SIM_LEFT_MTR_GAIN;
+        }
+        wheel_v[m] += (target - wheel_v[m]) * alpha;
+    }
+
+    dl = wheel_v[HAL_LEFT_MTR] * dt;
+    dr = wheel_v[HAL_RIGHT_MTR] * dt;
+    wheel_dist[HAL_LEFT_MTR] += dl;
+    wheel_dist[HAL_RIGHT_MTR] += dr;
+
+    ds = (dl + dr) / 2;
+    dtheta = (dr - dl) / SIM_TRACK_MM;
+    pose_x += ds * cos(pose_theta + dtheta / 2);
+    pose_y += ds * sin(pose_theta + dtheta / 2);
+    pose_theta = remainder(pose_theta + dtheta, 2 * M_PI);
+    pose_cos = cos(pose_theta);
+    pose_sin = sin(pose_theta);
+
+    //push the body back out of whatever it ran into
+    near_obstacle = NearObstacle();
+    for (pass = 0; near_obstacle && (pass < SIM_PUSHOUT_PASSES); pass++) {
+        SimPoint_t worst = {0.0, 0.0};
+        for (k = 0; k < 8; k++) {
+            SimPoint_t push = Penetration(ToWorld(BodyPoints[k]));
+            if (fabs(push.x) > fabs(worst.x)) worst.x = push.x;
+            if (fabs(push.y) > fabs(worst.y)) worst.y = push.y;
+        }
+        if ((worst.x == 0.0) && (worst.y == 0.0)) {
+            break;
+        }
+        pose_x += worst.x;
+        pose_y += worst.y;
+    }
+}
+
+static void UpdateSensors(void) {
+    uint16_t tape = 0;
+    uint16_t chatter = 0; //sensors over a tape edge, they read at random
+    uint8_t bumpers = 0;
+    uint8_t beacons;
+    uint16_t tones[HAL_NUM_BEACONS];
+    uint8_t wire_near[HAL_NUM_TRACK_WIRES];
+    uint16_t wire_reading[HAL_NUM_TRACK_WIRES];
+    uint8_t i;
+    //the burst only reaches the HAL, the statistics below see the real arena
+    uint8_t burst = burst_period_ms && (SimMillis() % burst_period_ms) < SIM_BURST_WIDTH_MS;
+
+    for (i = 0; i < 5; i++) {
+        if (OnFloorTape(ToWorld(TapeSensors[i]))) {
+            tape |= (1 << i);
+        }
+        if ((tape_edge_mm > 0) && OnFloorTapeEdge(ToWorld(TapeSensors[i]))) {
+            chatter |= (SimRand() & 1) << i;
+        }
+    }
+    if (near_obstacle) {
+        SimPoint_t back = {-SIM_SIDE_TAPE_SPAN_MM, SIM_BODY_HALF_MM};
+        SimPoint_t front = {SIM_SIDE_TAPE_SPAN_MM, SIM_BODY_HALF_MM};
+        if (OnHoleTape(ToWorld(back))) tape |= SIDE_BACK_TAPE_MASK;
+        if (OnHoleTape(ToWorld(front))) tape |= SIDE_FRONT_TAPE_MASK;
+    }
+    HAL_HostSetTape(burst ? (tape | ALL_FLOOR_TAPE_MASK) : (tape ^ chatter));
+
+    if (near_obstacle) {
+        for (i = 0; i < 6; i++) {
+            uint8_t k;
+            for (k = 0; k < PROBES_PER_BUMPER; k++) {
+                if (InObstacle(ToWorld(BumperProbes[i][k]))) {
+                    bumpers |= (1 << i);
+                    break;
+                }
+            }
+        }
+    }
+    HAL_HostSetBumpers(burst ? ALL_BUMPERS_MASK : bumpers);
+
+    beacons = BeaconTones(tones);
+    for (i = 0; i < HAL_NUM_BEACONS; i++) {
+        HAL_HostSetBeacon(i, SimAnalog(SIM_BEACON_DC));
+        HAL_HostSetBeaconTone(i, burst ? SIM_BEACON_TONE : tones[i]);
+    }
+
+    for (i = 0; i < HAL_NUM_TRACK_WIRES; i++) {
+        SimPoint_t tw = {i ? -SIM_TRACK_WIRE_SPAN_MM : SIM_TRACK_WIRE_SPAN_MM, SIM_BODY_HALF_MM};
+        wire_near[i] = near_obstacle && NearTrackWire(ToWorld(tw));
+        wire_reading[i] = SimAnalog(wire_near[i] ? track_wire_high : track_wire_low);
+        HAL_HostSetTrackWire(i, wire_reading[i]);
+    }
+    if (track_wire_log) {
+        fprintf(track_wire_log, "%d,%u,%u,%u,%u\n", SimMillis(), wire_near[0], wire_near[1], wire_reading[0],
+                wire_reading[1]);
+    }
+
+    if (battery_end) {
+        int32_t t = (SimMillis() < SIM_BATTERY_DRAIN_MS) ? SimMillis() : SIM_BATTERY_DRAIN_MS;
+        HAL_HostSetBattery(SimAnalog(SIM_BATTERY_NOMINAL + (battery_end - SIM_BATTERY_NOMINAL) * t / SIM_BATTERY_DRAIN_MS));
+    }
+
+    //walk the pins through every edge so an edge triggered decoder sees them all
+    for (i = 0; i < HAL_NUM_MTRS; i++) {
+        int32_t ticks = (int32_t) floor(wheel_dist[i] * (ENC_TICKS_PER_REV / (M_PI * WHEEL_DIAM_MM)));
+        while (wheel_ticks[i] != ticks) {
+            wheel_ticks[i] += (ticks > wheel_ticks[i]) ? 1 : -1;
+            HAL_HostSetEncoder(i, QuadPhase[wheel_ticks[i] & 0x3]);
+        }
+    }
+
+    //statistics
+    if ((bumpers & ~last_bumpers) != 0) {
+        num_bumps++;
+    }
+    if ((tape & ALL_FLOOR_TAPE_MASK & ~last_tape) != 0) {
+        num_tape_hits++;
+    }
+    if ((first_beacon_ms < 0) && (beacons & FRONT_BEACON_MASK)) {
+        first_beacon_ms = SimMillis();
+    }
+    if ((first_tower_ms < 0) && (bumpers & (FRONT_LEFT_BMP_MASK | FRONT_RIGHT_BMP_MASK))) {
+        //only count towers, not the walls
+        double d = 1e9;
+        for (i = 0; i < SIM_NUM_TOWERS; i++) {
+            double dx = Towers[i].center.x - pose_x;
+            double dy = Towers[i].center.y - pose_y;
+            if (sqrt(dx * dx + dy * dy) < d) d = sqrt(dx * dx + dy * dy);
+        }
+        if (d < 2 * (SIM_TOWER_HALF_MM + SIM_BODY_HALF_MM)) {
+            first_tower_ms = SimMillis();
+        }
+    }
+    if ((first_wire_ms < 0) && near_obstacle && NearTrackWire(ToWorld((SimPoint_t) {SIM_TRACK_WIRE_SPAN_MM, SIM_BODY_HALF_MM}))
+            && NearTrackWire(ToWorld((SimPoint_t) {-SIM_TRACK_WIRE_SPAN_MM, SIM_BODY_HALF_MM}))) {
+        first_wire_ms = SimMillis();
+    }
+    last_bumpers = bumpers;
+    last_tape = tape;
+}
+
+static void UpdateShots(void) {
+    uint8_t solenoid = HAL_HostGetSolenoid();
+
+    if (solenoid && !last_solenoid) {
+        SimPoint_t hole = {0, SIM_BODY_HALF_MM};
+        num_shots++;
+        if (OnHoleTape(ToWorld(hole))) {
+            num_scored++;
+            if (first_score_ms < 0) {
+                first_score_ms = SimMillis();
+            }
+        }
+        printf("SIM %8.3f: ball fired at (%.0f, %.0f) %s\n", sim_time_us / 1e6, pose_x, pose_y,
+                OnHoleTape(ToWorld(hole)) ? "SCORED" : "missed");
+    }
+    last_solenoid = solenoid;
+}
+
+/*******************************************************************************
+ * PUBLIC FUNCTIONS                                                            *
+ ******************************************************************************/
+
+void ArenaSim_Init(void) {
+    const char *env;
+
+    env = getenv("ROBOT_SIM_SEED");
+    if (env) {
+        rng_state = strtoul(env, NULL, 10);
+        if (0 == rng_state) {
+            rng_state = 1;
+        }
+    }
+    env = getenv("ROBOT_SIM_START");
+    if (env) {
+        double x, y, deg;
+        if (3 == sscanf(env, "%lf,%lf,%lf", &x, &y, &deg)) {
+            pose_x = x;
+            pose_y = y;
+            pose_theta = DEG_TO_RAD(deg);
+        }
+    }
+    env = getenv("ROBOT_SIM_BURST_MS");
+    if (env) {
+        burst_period_ms = strtoul(env, NULL, 10);
+    }
+    env = getenv("ROBOT_SIM_TAPE_EDGE_MM");
+    if (env) {
+        tape_edge_mm = strtod(env, NULL);
+    }
+    env = getenv("ROBOT_SIM_BATTERY_END");
+    if (env) {
+        battery_end = strtol(env, NULL, 10);
+    }
+    env = getenv("ROBOT_SIM_TRACK_WIRE");
+    if (env) {
+        unsigned low, high;
+        if (2 == sscanf(env, "%u,%u", &low, &high)) {
+            track_wire_low = low;
+            track_wire_high = high;
+        }
+    }
+    env = getenv("ROBOT_SIM_TRACK_WIRE_LOG");
+    if (env) {
+        track_wire_log = fopen(env, "w");
+        if (!track_wire_log) {
+            perror(env);
+        }
+    }
+    env = getenv("ROBOT_SIM_LOG_MS");
+    if (env) {
+        log_period_ms = strtoul(env, NULL, 10);
+        printf("sim_ms,x_mm,y_mm,heading_deg,left_duty,right_duty,tape,bumpers\n");
+    }
+
+    start_x = pose_x;
+    start_y = pose_y;
+    start_theta = pose_theta;
+
+    HAL_HostSetBattery(SIM_BATTERY_NOMINAL);
+    pose_cos = cos(pose_theta);
+    pose_sin = sin(pose_theta);
+    near_obstacle = NearObstacle();
+    UpdateSensors();
+    HAL_HostSetStepFunc(ArenaSim_Step);
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+    atexit(ArenaSim_Report);
+}
+
+void ArenaSim_Step(uint32_t elapsed_us) {
+    step_accum_us += elapsed_us;
+    while (step_accum_us >= SIM_STEP_US) {
+        step_accum_us -= SIM_STEP_US;
+        sim_time_us += SIM_STEP_US;
+
+        UpdateMotion(SIM_STEP_US / 1e6);
+        UpdateSensors();
+        UpdateShots();
+
+        if (log_period_ms && (SimMillis() >= next_log_ms)) {
+            next_log_ms += log_period_ms;
+            printf("%d,%.1f,%.1f,%.1f,%d,%d,0x%02X,0x%02X\n", SimMillis(), pose_x, pose_y,
+                    RAD_TO_DEG(pose_theta), HAL_HostGetMotor(HAL_LEFT_MTR),
+                    HAL_HostGetMotor(HAL_RIGHT_MTR), last_tape, last_bumpers);
+        }
+    }
+}
+
+void ArenaSim_Report(void) {
+    struct timespec wall_end;
+    double wall_s;
+    double sim_s = sim_time_us / 1e6;
+    Robot_Pose_t odom = Robot_GetPose();
+    double odom_x = odom.x / 65536.0;
+    double odom_y = odom.y / 65536.0;
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    wall_s = (wall_end.tv_sec - wall_start.tv_sec) + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e9;
+
+    printf("\nSIM report\n");
+    printf("  simulated %.3f s in %.3f s wall (%.0fx real time)\n", sim_s, wall_s,
+            (wall_s > 0) ? sim_s / wall_s : 0.0);
+    printf("  final pose (%.0f mm, %.0f mm, %.0f deg)\n", pose_x, pose_y, RAD_TO_DEG(pose_theta));
+    //odometry starts at 0 in the robot frame, put it in arena coordinates
+    printf("  odometry pose (%.0f mm, %.0f mm, %.0f deg)\n",
+            start_x + odom_x * cos(start_theta) - odom_y * sin(start_theta),
+            start_y + odom_x * sin(start_theta) + odom_y * cos(start_theta),
+            fmod(RAD_TO_DEG(start_theta) + ANGLE_TO_DEG(odom.heading) + 540.0, 360.0) - 180.0);
+    printf("  first beacon in view %d ms, first tower contact %d ms\n", first_beacon_ms, first_tower_ms);
+    printf("  first track wire %d ms, first score %d ms\n", first_wire_ms, first_score_ms);
+    printf("  bumps %u, tape crossings %u, shots %u, scored %u\n", num_bumps, num_tape_hits,
+            num_shots, num_scored);
+    printf("  encoder ticks left %d/%d, right %d/%d (decoded/simulated)\n", Robot_GetLeftEncTicks(),
+            wheel_ticks[HAL_LEFT_MTR], Robot_GetRightEncTicks(), wheel_ticks[HAL_RIGHT_MTR]);
+    printf("  battery %d, filtered %d\n", Robot_BatteryVoltage(), Robot_BatteryFiltered());
+    fflush(stdout);
+}
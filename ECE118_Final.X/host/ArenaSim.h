@@ -0,0 +1,62 @@
+/*
+ * File:   ArenaSim.h
+ *
+ * 2D differential drive simulator for the host build. Plugs into the virtual
+ * clock of robot_hal_posix.c (HAL_HostSetStepFunc) and produces the tape,
+ * bumper, beacon, track wire and encoder inputs the unmodified event checkers
+ * and RobotHSM read, from the motor duty and solenoid outputs they write.
+ *
+ * Everything is deterministic for a given ROBOT_SIM_SEED, so a full match can
+ * be rerun bit for bit while tuning the state machines.
+ *
+ * Environment (all optional):
+ *   ROBOT_SIM_SEED    - sensor noise seed (default 1)
+ *   ROBOT_SIM_START   - "x,y,deg" start pose in mm/deg (default 400,1200,90)
+ *   ROBOT_SIM_LOG_MS  - print a CSV pose line every N ms of simulated time
+ *   ROBOT_SIM_BURST_MS - every N ms every tape sensor, bumper and beacon
+ *                       detector reads "on" for SIM_BURST_WIDTH_MS, so all
+ *                       the checkers and services post at once (queue sizing,
+ *                       see queue_stats.h and "make stress")
+ *   ROBOT_SIM_TAPE_EDGE_MM - floor tape sensors within this distance of a
+ *                       tape edge read at random every physics step, like a
+ *                       real sensor half over the tape (tape_filter.h)
+ *   ROBOT_SIM_BATTERY_END - battery reading the pack drains to, in a straight
+ *                       line from SIM_BATTERY_NOMINAL over SIM_BATTERY_DRAIN_MS
+ *                       (default: stays at nominal, no ADC noise)
+ *   ROBOT_SIM_TRACK_WIRE - "low,high" track wire readings away from and over
+ *                       the wire (default SIM_TRACK_WIRE_LOW/HIGH, 420,640),
+ *                       e.g. a coil turned away or a different field
+ *   ROBOT_SIM_TRACK_WIRE_LOG - file to record both track wire sensors to every
+ *                       physics step, "ms,in range 0,in range 1,reading 0,
+ *                       reading 1" lines for trackwire_bench.c
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef ARENASIM_H
+#define	ARENASIM_H
+
+#include <stdint.h>
+
+//arena (mm), origin in the bottom left corner, x right, y up
+#define SIM_ARENA_MM 2438 //8 ft square
+#define SIM_TAPE_INSET_MM 100 //perimeter tape starts this far in from the wall
+#define SIM_TAPE_WIDTH_MM 50
+
+#define SIM_TOWER_HALF_MM 150
+#define SIM_NUM_TOWERS 2
+
+//robot body (mm), robot frame has x forward and y to the left
+#define SIM_BODY_HALF_MM 135
+#define SIM_TRACK_MM 230 //distance between the wheels
+#define SIM_MAX_WHEEL_MM_S 480 //free running wheel speed at 100% duty
+#define SIM_MOTOR_TAU_MS 60 //first order motor/wheel time constant
+
+#define SIM_STEP_US 2000 //physics step (500 Hz), sensors are updated at this rate
+#define SIM_BURST_WIDTH_MS 60 //longer than the bumper debounce period
+
+void ArenaSim_Init(void);
+void ArenaSim_Step(uint32_t elapsed_us);
+void ArenaSim_Report(void);
+
+#endif	/* ARENASIM_H */
@@ -0,0 +1,209 @@
+/*
+ * File:   ES_Port_Host.c
+ *
+ * Host (Linux/gcc) port of the hardware pieces of the ECE118 library: BOARD,
+ * serial and ES_Timers. The portable ES_Framework sources (ES_Framework.c,
+ * ES_Queue.c, ES_CheckEvents.c, ...) are compiled unchanged on top of this.
+ *
+ * The PIC32 drives the ES timers from the Timer1 interrupt. Here time is the
+ * virtual clock in robot_hal_posix.c, and CheckHostClock (first entry of
+ * EVENT_CHECK_LIST in host builds) advances it by HOST_LOOP_US on every pass
+ * of the ES_Run loop, then fires any expired timers through the
+ * TIMERx_RESP_FUNC table exactly like the interrupt does. The pins are driven
+ * by the arena simulator (ArenaSim.c), which is stepped by the same clock.
+ *
+ * Created on October 17, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "BOARD.h"
+#include "serial.h"
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "ES_Timers.h"
+#include "Bot_EventCheckers.h"
+#include "robot_hal.h"
+#include "ArenaSim.h"
+#include "queue_stats.h"
+#include "event_trace.h"
+#ifdef USE_PROFILER
+#include "loop_profiler.h"
+#endif
+
+/*******************************************************************************
+ * MODULE #DEFINES                                                             *
+ ******************************************************************************/
+#ifndef HOST_LOOP_US
+#define HOST_LOOP_US 50 //virtual time for one pass of the ES_Run loop, override with ROBOT_HOST_LOOP_US
+#endif
+
+#ifndef HOST_RUN_TIME_MS
+#define HOST_RUN_TIME_MS 120000 //one full match, override with ROBOT_HOST_RUN_MS
+#endif
+
+#define NUM_TIMERS 16
+
+/*******************************************************************************
+ * PRIVATE MODULE VARIABLES                                                    *
+ ******************************************************************************/
+static pPostFunc const Timer_ResponseFunctions[NUM_TIMERS] = {
+    TIMER0_RESP_FUNC, TIMER1_RESP_FUNC, TIMER2_RESP_FUNC, TIMER3_RESP_FUNC,
+    TIMER4_RESP_FUNC, TIMER5_RESP_FUNC, TIMER6_RESP_FUNC, TIMER7_RESP_FUNC,
+    TIMER8_RESP_FUNC, TIMER9_RESP_FUNC, TIMER10_RESP_FUNC, TIMER11_RESP_FUNC,
+    TIMER12_RESP_FUNC, TIMER13_RESP_FUNC, TIMER14_RESP_FUNC, TIMER15_RESP_FUNC
+};
+
+static uint32_t TimerArray[NUM_TIMERS]; //expiry time in ms
+static uint32_t TimerLength[NUM_TIMERS];
+static uint16_t TimerActiveFlags;
+static uint32_t NextExpiry; //earliest TimerArray entry of the active timers
+static uint32_t RunTimeMs = HOST_RUN_TIME_MS;
+static uint32_t LoopUs = HOST_LOOP_US;
+
+/*******************************************************************************
+ * BOARD / SERIAL                                                              *
+ ******************************************************************************/
+
+void BOARD_Init(void) {
+    const char *run_ms = getenv("ROBOT_HOST_RUN_MS");
+
+    const char *loop_us = getenv("ROBOT_HOST_LOOP_US");
+
+    if (run_ms) {
+        RunTimeMs = strtoul(run_ms, NULL, 10);
+    }
+    if (loop_us) {
+        LoopUs = strtoul(loop_us, NULL, 10);
+    }
+    SERIAL_Init();
+    ArenaSim_Init();
+}
+
+void BOARD_End(void) {
+    exit(0);
+}
+
+unsigned int BOARD_GetPBClock(void) {
+    return 40000000;
+}
+
+void SERIAL_Init(void) {
+    setvbuf(stdout, NULL, _IOFBF, 1 << 16);
+}
+
+void PutChar(char ch) {
+    putchar(ch);
+}
+
+char GetChar(void) {
+    return 0;
+}
+
+char IsTransmitEmpty(void) {
+    return TRUE;
+}
+
+char IsReceiveEmpty(void) {
+    return TRUE;
+}
+
+/*******************************************************************************
+ * ES_TIMERS                                                                   *
+ ******************************************************************************/
+
+void ES_Timer_Init(void) {
+    TimerActiveFlags = 0;
+}
+
+int8_t ES_Timer_SetTimer(uint8_t Num, uint32_t NewTime) {
+    if ((Num >= NUM_TIMERS) || (Timer_ResponseFunctions[Num] == TIMER_UNUSED) || (NewTime == 0)) {
+        return ERROR;
+    }
+    TimerLength[Num] = NewTime;
+    return SUCCESS;
+}
+
+int8_t ES_Timer_StartTimer(uint8_t Num) {
+    if ((Num >= NUM_TIMERS) || (Timer_ResponseFunctions[Num] == TIMER_UNUSED)) {
+        return ERROR;
+    }
+    TimerArray[Num] = ES_Timer_GetTime() + TimerLength[Num];
+    if (!TimerActiveFlags || ((int32_t) (TimerArray[Num] - NextExpiry) < 0)) {
+        NextExpiry = TimerArray[Num];
+    }
+    TimerActiveFlags |= (1 << Num);
+    return SUCCESS;
+}
+
+int8_t ES_Timer_StopTimer(uint8_t Num) {
+    if ((Num >= NUM_TIMERS) || (Timer_ResponseFunctions[Num] == TIMER_UNUSED)) {
+        return ERROR;
+    }
+    TimerActiveFlags &= ~(1 << Num);
+    return SUCCESS;
+}
+
+int8_t ES_Timer_InitTimer(uint8_t Num, uint32_t NewTime) {
+    if (ES_Timer_SetTimer(Num, NewTime) == ERROR) {
+        return ERROR;
+    }
+    return ES_Timer_StartTimer(Num);
+}
+
+uint32_t ES_Timer_GetTime(void) {
+    return (uint32_t) (HAL_HostGetMicros() / 1000);
+}
+
+/*******************************************************************************
+ * HOST CLOCK EVENT CHECKER                                                    *
+ ******************************************************************************/
+
+/**
+ * @Function CheckHostClock(void)
+ * @return FALSE, timer events are posted directly to their services
+ * @brief Advances the virtual clock one loop period, expires ES timers and
+ *        ends the run once ROBOT_HOST_RUN_MS of virtual time has passed. */
+uint8_t CheckHostClock(void) {
+    uint32_t now;
+    uint8_t CurTimer;
+    ES_Event ThisEvent;
+
+    HAL_HostAdvance(LoopUs);
+    now = ES_Timer_GetTime();
+
+    //only scan the table once the earliest deadline has passed, most passes
+    //of the loop have nothing to expire
+    if (TimerActiveFlags && ((int32_t) (now - NextExpiry) >= 0)) {
+        for (CurTimer = 0; CurTimer < NUM_TIMERS; CurTimer++) {
+            if ((TimerActiveFlags & (1 << CurTimer)) && ((int32_t) (now - TimerArray[CurTimer]) >= 0)) {
+                TimerActiveFlags &= ~(1 << CurTimer);
+                ThisEvent.EventType = ES_TIMEOUT;
+                ThisEvent.EventParam = CurTimer;
+                Timer_ResponseFunctions[CurTimer](ThisEvent);
+            }
+        }
+        //response functions may have restarted timers, recompute the deadline
+        NextExpiry = now + 0x7FFFFFFF;
+        for (CurTimer = 0; CurTimer < NUM_TIMERS; CurTimer++) {
+            if ((TimerActiveFlags & (1 << CurTimer)) && ((int32_t) (TimerArray[CurTimer] - NextExpiry) < 0)) {
+                NextExpiry = TimerArray[CurTimer];
+            }
+        }
+    }
+
+    if (now >= RunTimeMs) {
+        QStat_Dump();
+        Tape_PrintFilterStats();
+        TrackWire_PrintBand();
+        if (getenv("ROBOT_HOST_TRACE")) {
+            Trace_Dump();
+        }
+#ifdef USE_PROFILER
+        Prof_Dump();
+#endif
+        fflush(stdout);
+        exit(0);
+    }
+    return FALSE;
+}
@@ -0,0 +1,18 @@
+/*
+ * File:   BOARD.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef BOARD_H
+#define BOARD_H
+#include <stdint.h>
+#define TRUE 1
+#define FALSE 0
+#define SUCCESS 0
+#define ERROR -1
+void BOARD_Init(void);
+void BOARD_End(void);
+unsigned int BOARD_GetPBClock(void);
+#endif
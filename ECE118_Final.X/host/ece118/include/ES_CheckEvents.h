@@ -0,0 +1,12 @@
+/*
+ * File:   ES_CheckEvents.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_CHECKEVENTS_H
+#define ES_CHECKEVENTS_H
+#include <stdint.h>
+uint8_t ES_CheckUserEvents(void);
+#endif
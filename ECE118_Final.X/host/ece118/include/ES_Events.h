@@ -0,0 +1,17 @@
+/*
+ * File:   ES_Events.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_EVENTS_H
+#define ES_EVENTS_H
+#include <stdint.h>
+#include "ES_Configure.h"
+typedef struct ES_Event { ES_EventTyp_t EventType; uint16_t EventParam; } ES_Event;
+#define INIT_EVENT ((ES_Event){ES_INIT, 0})
+#define ENTRY_EVENT ((ES_Event){ES_ENTRY, 0})
+#define EXIT_EVENT ((ES_Event){ES_EXIT, 0})
+typedef uint8_t (*pPostFunc)(ES_Event);
+#endif
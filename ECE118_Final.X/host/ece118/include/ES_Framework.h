@@ -0,0 +1,24 @@
+/*
+ * File:   ES_Framework.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_FRAMEWORK_H
+#define ES_FRAMEWORK_H
+#include "ES_Configure.h"
+#include "ES_General.h"
+#include "ES_Events.h"
+#include "ES_PostList.h"
+#include "ES_Timers.h"
+#include "ES_Queue.h"
+#include "ES_CheckEvents.h"
+#include "ES_TattleTale.h"
+#include "ES_ServiceHeaders.h"
+typedef enum { Success = 0, FailedPost = 1, FailedRun, FailedPointer, FailedIndex, FailedInit } ES_Return_t;
+ES_Return_t ES_Initialize(void);
+ES_Return_t ES_Run(void);
+uint8_t ES_PostAll(ES_Event ThisEvent);
+uint8_t ES_PostToService(uint8_t WhichService, ES_Event TheEvent);
+#endif
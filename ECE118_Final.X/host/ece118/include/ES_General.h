@@ -0,0 +1,11 @@
+/*
+ * File:   ES_General.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_GENERAL_H
+#define ES_GENERAL_H
+#include "BOARD.h"
+#endif
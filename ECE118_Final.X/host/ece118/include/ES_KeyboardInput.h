@@ -0,0 +1,14 @@
+/*
+ * File:   ES_KeyboardInput.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_KEYBOARDINPUT_H
+#define ES_KEYBOARDINPUT_H
+#include "ES_Events.h"
+uint8_t InitKeyboardInput(uint8_t Priority);
+uint8_t PostKeyboardInput(ES_Event ThisEvent);
+ES_Event RunKeyboardInput(ES_Event ThisEvent);
+#endif
@@ -0,0 +1,10 @@
+/*
+ * File:   ES_PostList.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_POSTLIST_H
+#define ES_POSTLIST_H
+#endif
@@ -0,0 +1,15 @@
+/*
+ * File:   ES_Queue.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_QUEUE_H
+#define ES_QUEUE_H
+#include "ES_Events.h"
+uint8_t ES_InitQueue(ES_Event * pBlock, unsigned char BlockSize);
+uint8_t ES_EnQueueFIFO(ES_Event * pBlock, ES_Event Event2Add);
+uint8_t ES_DeQueue(ES_Event * pBlock, ES_Event * pReturnEvent);
+uint8_t ES_IsQueueEmpty(ES_Event * pBlock);
+#endif
@@ -0,0 +1,33 @@
+/*
+ * File:   ES_ServiceHeaders.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_SERVICEHEADERS_H
+#define ES_SERVICEHEADERS_H
+#include "ES_Configure.h"
+#include SERV_0_HEADER
+#if NUM_SERVICES > 1
+#include SERV_1_HEADER
+#endif
+#if NUM_SERVICES > 2
+#include SERV_2_HEADER
+#endif
+#if NUM_SERVICES > 3
+#include SERV_3_HEADER
+#endif
+#if NUM_SERVICES > 4
+#include SERV_4_HEADER
+#endif
+#if NUM_SERVICES > 5
+#include SERV_5_HEADER
+#endif
+#if NUM_SERVICES > 6
+#include SERV_6_HEADER
+#endif
+#if NUM_SERVICES > 7
+#include SERV_7_HEADER
+#endif
+#endif
@@ -0,0 +1,20 @@
+/*
+ * File:   ES_TattleTale.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_TATTLETALE_H
+#define ES_TATTLETALE_H
+#include "ES_Events.h"
+#ifdef USE_TATTLETALE
+void ES_AddTattlePoint(const char * FunctionName, const char * StateName, ES_Event ThisEvent);
+void ES_CheckTail(const char * FunctionName);
+#define ES_Tattle() ES_AddTattlePoint(__func__, StateNames[CurrentState], ThisEvent)
+#define ES_Tail() ES_CheckTail(__func__)
+#else
+#define ES_Tattle()
+#define ES_Tail()
+#endif
+#endif
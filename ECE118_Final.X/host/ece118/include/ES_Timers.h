@@ -0,0 +1,18 @@
+/*
+ * File:   ES_Timers.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef ES_TIMERS_H
+#define ES_TIMERS_H
+#include <stdint.h>
+#include "ES_Events.h"
+void ES_Timer_Init(void);
+int8_t ES_Timer_InitTimer(uint8_t Num, uint32_t NewTime);
+int8_t ES_Timer_SetTimer(uint8_t Num, uint32_t NewTime);
+int8_t ES_Timer_StartTimer(uint8_t Num);
+int8_t ES_Timer_StopTimer(uint8_t Num);
+uint32_t ES_Timer_GetTime(void);
+#endif
@@ -0,0 +1,16 @@
+/*
+ * File:   serial.h
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#ifndef SERIAL_H
+#define SERIAL_H
+#include <stdint.h>
+void SERIAL_Init(void);
+void PutChar(char ch);
+char GetChar(void);
+char IsTransmitEmpty(void);
+char IsReceiveEmpty(void);
+#endif
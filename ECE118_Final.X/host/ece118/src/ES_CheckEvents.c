@@ -0,0 +1,20 @@
+/*
+ * File:   ES_CheckEvents.c
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#include "ES_Configure.h"
+#include "ES_Events.h"
+#include "ES_General.h"
+#include "ES_CheckEvents.h"
+#include EVENT_CHECK_HEADER
+static uint8_t(*const ES_EventList[])(void) = {EVENT_CHECK_LIST};
+uint8_t ES_CheckUserEvents(void) {
+    unsigned i;
+    for (i = 0; i < sizeof (ES_EventList) / sizeof (ES_EventList[0]); i++) {
+        if (ES_EventList[i]() == TRUE) break;
+    }
+    return i != sizeof (ES_EventList) / sizeof (ES_EventList[0]);
+}
@@ -0,0 +1,107 @@
+/*
+ * File:   ES_Framework.c
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#include "ES_Framework.h"
+#include "serial.h"
+typedef struct { uint8_t (*InitFunc)(uint8_t); ES_Event (*RunFunc)(ES_Event); } ES_ServDesc;
+static const ES_ServDesc ServDescList[] = {
+    {SERV_0_INIT, SERV_0_RUN},
+#if NUM_SERVICES > 1
+    {SERV_1_INIT, SERV_1_RUN},
+#endif
+#if NUM_SERVICES > 2
+    {SERV_2_INIT, SERV_2_RUN},
+#endif
+#if NUM_SERVICES > 3
+    {SERV_3_INIT, SERV_3_RUN},
+#endif
+#if NUM_SERVICES > 4
+    {SERV_4_INIT, SERV_4_RUN},
+#endif
+#if NUM_SERVICES > 5
+    {SERV_5_INIT, SERV_5_RUN},
+#endif
+#if NUM_SERVICES > 6
+    {SERV_6_INIT, SERV_6_RUN},
+#endif
+#if NUM_SERVICES > 7
+    {SERV_7_INIT, SERV_7_RUN},
+#endif
+};
+static ES_Event Queue0[SERV_0_QUEUE_SIZE + 1];
+#if NUM_SERVICES > 1
+static ES_Event Queue1[SERV_1_QUEUE_SIZE + 1];
+#endif
+#if NUM_SERVICES > 2
+static ES_Event Queue2[SERV_2_QUEUE_SIZE + 1];
+#endif
+#if NUM_SERVICES > 3
+static ES_Event Queue3[SERV_3_QUEUE_SIZE + 1];
+#endif
+#if NUM_SERVICES > 4
+static ES_Event Queue4[SERV_4_QUEUE_SIZE + 1];
+#endif
+#if NUM_SERVICES > 5
+static ES_Event Queue5[SERV_5_QUEUE_SIZE + 1];
+#endif
+#if NUM_SERVICES > 6
+static ES_Event Queue6[SERV_6_QUEUE_SIZE + 1];
+#endif
+#if NUM_SERVICES > 7
+static ES_Event Queue7[SERV_7_QUEUE_SIZE + 1];
+#endif
+static struct { ES_Event *pMem; uint8_t Size; } EventQueues[] = {
+    {Queue0, SERV_0_QUEUE_SIZE + 1},
+#if NUM_SERVICES > 1
+    {Queue1, SERV_1_QUEUE_SIZE + 1},
+#endif
+#if NUM_SERVICES > 2
+    {Queue2, SERV_2_QUEUE_SIZE + 1},
+#endif
+#if NUM_SERVICES > 3
+    {Queue3, SERV_3_QUEUE_SIZE + 1},
+#endif
+#if NUM_SERVICES > 4
+    {Queue4, SERV_4_QUEUE_SIZE + 1},
+#endif
+#if NUM_SERVICES > 5
+    {Queue5, SERV_5_QUEUE_SIZE + 1},
+#endif
+#if NUM_SERVICES > 6
+    {Queue6, SERV_6_QUEUE_SIZE + 1},
+#endif
+#if NUM_SERVICES > 7
+    {Queue7, SERV_7_QUEUE_SIZE + 1},
+#endif
+};
+#define NSERV (sizeof(ServDescList)/sizeof(ServDescList[0]))
+static uint8_t Ready;
+ES_Return_t ES_Initialize(void) {
+    unsigned i;
+    ES_Timer_Init();
+    for (i = 0; i < NSERV; i++) {
+        ES_InitQueue(EventQueues[i].pMem, EventQueues[i].Size);
+        if (ServDescList[i].InitFunc(i) != TRUE) return FailedInit;
+    }
+    return Success;
+}
+uint8_t ES_PostToService(uint8_t Which, ES_Event E) {
+    if (Which < NSERV && ES_EnQueueFIFO(EventQueues[Which].pMem, E) == TRUE) { Ready |= 1 << Which; return TRUE; }
+    return FALSE;
+}
+uint8_t ES_PostAll(ES_Event E) { unsigned i; for (i = 0; i < NSERV; i++) if (!ES_PostToService(i, E)) return FALSE; return TRUE; }
+ES_Return_t ES_Run(void) {
+    while (1) {
+        while (Ready) {
+            int p; ES_Event E;
+            for (p = 7; p >= 0; p--) if (Ready & (1 << p)) break;
+            if (ES_DeQueue(EventQueues[p].pMem, &E) == 0) Ready &= ~(1 << p);
+            ServDescList[p].RunFunc(E);
+        }
+        ES_CheckUserEvents();
+    }
+}
@@ -0,0 +1,14 @@
+/*
+ * File:   ES_KeyboardInput.c
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#include "ES_Framework.h"
+#include "ES_KeyboardInput.h"
+#include "serial.h"
+static uint8_t MyPriority;
+uint8_t InitKeyboardInput(uint8_t Priority) { MyPriority = Priority; return ES_PostToService(MyPriority, INIT_EVENT); }
+uint8_t PostKeyboardInput(ES_Event ThisEvent) { return ES_PostToService(MyPriority, ThisEvent); }
+ES_Event RunKeyboardInput(ES_Event ThisEvent) { ES_Event r = {ES_NO_EVENT, 0}; (void) ThisEvent; return r; }
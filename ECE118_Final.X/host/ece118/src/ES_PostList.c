@@ -0,0 +1,8 @@
+/*
+ * File:   ES_PostList.c
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#include "ES_Framework.h"
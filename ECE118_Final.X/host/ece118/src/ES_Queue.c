@@ -0,0 +1,33 @@
+/*
+ * File:   ES_Queue.c
+ *
+ * Host stand-in for the ECE118 course library file of the same name, only
+ * the part the robot application uses. See ece118/README.
+ */
+
+#include "ES_Queue.h"
+typedef struct { unsigned char QueueSize, CurrentIndex, NumEntries; } ES_QueueHead;
+uint8_t ES_InitQueue(ES_Event * pBlock, unsigned char BlockSize) {
+    ES_QueueHead *h = (ES_QueueHead *) pBlock;
+    h->QueueSize = BlockSize - 1; h->CurrentIndex = 0; h->NumEntries = 0;
+    return h->QueueSize;
+}
+uint8_t ES_EnQueueFIFO(ES_Event * pBlock, ES_Event E) {
+    ES_QueueHead *h = (ES_QueueHead *) pBlock;
+    if (h->NumEntries < h->QueueSize) {
+        pBlock[1 + ((h->CurrentIndex + h->NumEntries) % h->QueueSize)] = E;
+        h->NumEntries++;
+        return 1;
+    }
+    return 0;
+}
+uint8_t ES_DeQueue(ES_Event * pBlock, ES_Event * r) {
+    ES_QueueHead *h = (ES_QueueHead *) pBlock;
+    if (h->NumEntries > 0) {
+        *r = pBlock[1 + h->CurrentIndex];
+        h->CurrentIndex = (h->CurrentIndex + 1) % h->QueueSize;
+        h->NumEntries--;
+    } else { r->EventType = ES_NO_EVENT; r->EventParam = 0; }
+    return h->NumEntries;
+}
+uint8_t ES_IsQueueEmpty(ES_Event * pBlock) { return ((ES_QueueHead *) pBlock)->NumEntries == 0; }
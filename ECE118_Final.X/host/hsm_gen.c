@@ -0,0 +1,312 @@
+/*
+ * File:   hsm_gen.c
+ *
+ * Turns a state machine spec (see RobotHSM.hsm) into the const tables for
+ * hsm_engine.c. Run from host/Makefile ("make hsm"), the output is checked in
+ * so the MPLAB build does not need it:
+ *
+ *   hsm_gen ../RobotHSM.hsm > ../RobotHSM_table.h
+ *
+ * The output has the state enum and StateNames[] (for ES_Tattle), prototypes
+ * of every guard, action and hook named in the spec (static, to be defined in
+ * the .c file that includes the table), and the states/transitions/slots
+ * tables plus the HSM_Machine_t that ties them together. Slots are written as
+ * designated initializers, so the table stays correct when events are added to
+ * ES_Configure.h and only the spec has to be regenerated when it changes.
+ *
+ * Created on October 17, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define MAX_STATES 64
+#define MAX_ROWS 254 //HSM_Slot_t indexes with a uint8_t
+#define MAX_NAMES 256
+#define NAME_LEN 64
+#define MAX_TOKENS 8
+
+typedef struct {
+    char name[NAME_LEN];
+    char entry[NAME_LEN];
+    char exit[NAME_LEN];
+    char sub[NAME_LEN];
+    char query[NAME_LEN];
+} State_t;
+
+typedef struct {
+    int state;
+    char event[NAME_LEN];
+    char guard[NAME_LEN];
+    char action[NAME_LEN];
+    int next; //-1 for none
+    int line;
+} Row_t;
+
+static char Machine[NAME_LEN];
+static State_t States[MAX_STATES];
+static int NumStates;
+static Row_t Rows[MAX_ROWS];
+static int NumRows;
+static const char *SpecName;
+
+static void Fail(int line, const char *msg, const char *what) {
+    fprintf(stderr, "%s:%d: %s %s\n", SpecName, line, msg, what ? what : "");
+    exit(1);
+}
+
+static int FindState(const char *name) {
+    int i;
+    for (i = 0; i < NumStates; i++) {
+        if (0 == strcmp(States[i].name, name)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void Copy(char *dst, const char *src, int line) {
+    if (strlen(src) >= NAME_LEN) {
+        Fail(line, "name too long:", src);
+    }
+    strcpy(dst, strcmp(src, "-") ? src : "");
+}
+
+static void ParseState(char **tok, int n, int line) {
+    State_t *s;
+    int i;
+
+    if (n < 2) {
+        Fail(line, "state needs a name", NULL);
+    }
+    if (FindState(tok[1]) >= 0) {
+        Fail(line, "duplicate state", tok[1]);
+    }
+    if (NumStates >= MAX_STATES) {
+        Fail(line, "too many states", NULL);
+    }
+    s = &States[NumStates++];
+    memset(s, 0, sizeof (*s));
+    Copy(s->name, tok[1], line);
+    for (i = 2; i < n; i++) {
+        if (0 == strncmp(tok[i], "entry=", 6)) {
+            Copy(s->entry, tok[i] + 6, line);
+        } else if (0 == strncmp(tok[i], "exit=", 5)) {
+            Copy(s->exit, tok[i] + 5, line);
+        } else if (0 == strncmp(tok[i], "sub=", 4)) {
+            Copy(s->sub, tok[i] + 4, line);
+        } else if (0 == strncmp(tok[i], "query=", 6)) {
+            Copy(s->query, tok[i] + 6, line);
+        } else {
+            Fail(line, "unknown state attribute", tok[i]);
+        }
+    }
+}
+
+static void ParseRow(char **tok, int n, int line) {
+    Row_t *r;
+
+    if (n != 5) {
+        Fail(line, "transition needs: state event guard action next", NULL);
+    }
+    if (NumRows >= MAX_ROWS) {
+        Fail(line, "too many transitions", NULL);
+    }
+    r = &Rows[NumRows++];
+    r->line = line;
+    r->state = FindState(tok[0]);
+    if (r->state < 0) {
+        Fail(line, "unknown state", tok[0]);
+    }
+    Copy(r->event, tok[1], line);
+    Copy(r->guard, tok[2], line);
+    Copy(r->action, tok[3], line);
+    if (0 == strcmp(tok[4], "-")) {
+        r->next = -1;
+    } else {
+        r->next = FindState(tok[4]);
+        if (r->next < 0) {
+            Fail(line, "unknown next state", tok[4]);
+        }
+    }
+    if (!r->event[0]) {
+        Fail(line, "transition needs an event", NULL);
+    }
+}
+
+static void Parse(FILE *in) {
+    char buf[512];
+    char *tok[MAX_TOKENS];
+    int line = 0;
+
+    while (fgets(buf, sizeof (buf), in)) {
+        char *p = strchr(buf, '#');
+        int n = 0;
+
+        line++;
+        if (p) {
+            *p = '\0';
+        }
+        for (p = strtok(buf, " \t\r\n"); p && (n < MAX_TOKENS); p = strtok(NULL, " \t\r\n")) {
+            tok[n++] = p;
+        }
+        if (0 == n) {
+            continue;
+        }
+        if (0 == strcmp(tok[0], "machine")) {
+            if (n != 2) {
+                Fail(line, "machine needs a name", NULL);
+            }
+            Copy(Machine, tok[1], line);
+        } else if (0 == strcmp(tok[0], "state")) {
+            ParseState(tok, n, line);
+        } else {
+            ParseRow(tok, n, line);
+        }
+    }
+    if (!Machine[0] || !NumStates) {
+        Fail(line, "spec needs a machine and at least one state", NULL);
+    }
+}
+
+//every function name is declared once, whatever role it is used in
+static const char *Declared[MAX_NAMES];
+static int NumDeclared;
+
+static void Declare(const char *name, const char *proto) {
+    int i;
+
+    if (!name[0]) {
+        return;
+    }
+    for (i = 0; i < NumDeclared; i++) {
+        if (0 == strcmp(Declared[i], name)) {
+            return;
+        }
+    }
+    if (NumDeclared < MAX_NAMES) {
+        Declared[NumDeclared++] = name;
+    }
+    printf(proto, name);
+}
+
+static const char *OrNull(const char *name) {
+    return name[0] ? name : "NULL";
+}
+
+static void Emit(void) {
+    char upper[NAME_LEN];
+    int order[MAX_ROWS];
+    int n = 0;
+    int s;
+    int i;
+    int j;
+
+    for (i = 0; Machine[i]; i++) {
+        upper[i] = toupper((unsigned char) Machine[i]);
+    }
+    upper[i] = '\0';
+
+    //group rows by state, then by event in first appearance order, keeping
+    //the spec order inside a group since that is the guard priority
+    for (s = 0; s < NumStates; s++) {
+        for (i = 0; i < NumRows; i++) {
+            int seen = 0;
+            if (Rows[i].state != s) {
+                continue;
+            }
+            for (j = 0; j < i; j++) {
+                if ((Rows[j].state == s) && (0 == strcmp(Rows[j].event, Rows[i].event))) {
+                    seen = 1;
+                }
+            }
+            if (seen) {
+                continue;
+            }
+            for (j = i; j < NumRows; j++) {
+                if ((Rows[j].state == s) && (0 == strcmp(Rows[j].event, Rows[i].event))) {
+                    order[n++] = j;
+                }
+            }
+        }
+    }
+
+    printf("/*\n * File:   %s_table.h\n *\n", Machine);
+    printf(" * Generated by host/hsm_gen from %s.hsm, edit the spec and run \"make hsm\"\n", Machine);
+    printf(" * in host/ instead of editing this file. Included once, by %s.c.\n */\n\n", Machine);
+    printf("#ifndef %s_TABLE_H\n#define %s_TABLE_H\n\n#include <stddef.h>\n#include \"hsm_engine.h\"\n\n", upper, upper);
+
+    printf("typedef enum {\n");
+    for (s = 0; s < NumStates; s++) {
+        printf("    %s,\n", States[s].name);
+    }
+    printf("    %s_NUM_STATES,\n} %sState_t;\n\n", upper, Machine);
+
+    printf("static const char *StateNames[] = {\n");
+    for (s = 0; s < NumStates; s++) {
+        printf("    \"%s\",\n", States[s].name);
+    }
+    printf("};\n\n");
+
+    printf("//guards, actions and hooks, defined in %s.c\n", Machine);
+    for (i = 0; i < NumRows; i++) {
+        Declare(Rows[i].guard, "static uint8_t %s(const ES_Event *ThisEvent);\n");
+    }
+    for (i = 0; i < NumRows; i++) {
+        Declare(Rows[i].action, "static void %s(ES_Event *ThisEvent);\n");
+    }
+    for (s = 0; s < NumStates; s++) {
+        Declare(States[s].entry, "static void %s(void);\n");
+        Declare(States[s].exit, "static void %s(void);\n");
+    }
+    printf("\n");
+
+    printf("static const HSM_State_t %sStates[%s_NUM_STATES] = {\n", Machine, upper);
+    for (s = 0; s < NumStates; s++) {
+        printf("    [%s] = {%s, %s, %s, %s},\n", States[s].name, OrNull(States[s].entry), OrNull(States[s].exit),
+                OrNull(States[s].sub), OrNull(States[s].query));
+    }
+    printf("};\n\n");
+
+    printf("static const HSM_Transition_t %sTransitions[] = {\n", Machine);
+    for (i = 0; i < n; i++) {
+        Row_t *r = &Rows[order[i]];
+        printf("    {%s, %s, %s}, //%s %s\n", OrNull(r->guard), OrNull(r->action),
+                (r->next < 0) ? "HSM_NO_STATE" : States[r->next].name, States[r->state].name, r->event);
+    }
+    printf("};\n\n");
+
+    printf("static const HSM_Slot_t %sSlots[%s_NUM_STATES][NUMBEROFEVENTS] = {\n", Machine, upper);
+    for (i = 0; i < n; i = j) {
+        Row_t *r = &Rows[order[i]];
+        for (j = i + 1; (j < n) && (Rows[order[j]].state == r->state) && (0 == strcmp(Rows[order[j]].event, r->event)); j++) {
+        }
+        printf("    [%s][%s] = {%d, %d},\n", States[r->state].name, r->event, i, j - i);
+    }
+    printf("};\n\n");
+
+    printf("static const HSM_Machine_t %sMachine = {%sStates, &%sSlots[0][0], %sTransitions};\n\n",
+            Machine, Machine, Machine, Machine);
+    printf("#endif /* %s_TABLE_H */\n", upper);
+}
+
+int main(int argc, char **argv) {
+    FILE *in;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s spec.hsm > table.h\n", argv[0]);
+        return 2;
+    }
+    SpecName = argv[1];
+    in = fopen(SpecName, "r");
+    if (!in) {
+        perror(SpecName);
+        return 1;
+    }
+    Parse(in);
+    fclose(in);
+    Emit();
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * File:   telem_decode.c
+ *
+ * Decodes a telemetry capture (see telemetry.h for the frame) into one line
+ * per frame, or CSV with -c. The capture is the raw bytes from the telemetry
+ * UART, or the ROBOT_HOST_TELEM file of a host run:
+ *
+ *   ROBOT_HOST_TELEM=match.bin ./build/robot_host
+ *   ./build/telem_decode match.bin
+ *   ./build/telem_decode -c match.bin > match.csv
+ *
+ * A frame only counts when its checksum matches, otherwise the decoder moves
+ * one byte on and looks for the next TELEM_SYNC, so a capture that starts in
+ * the middle of a frame or lost bytes on the wire resynchronizes by itself.
+ *
+ * Created on October 17, 2026
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "ES_Configure.h"
+#include "telemetry.h"
+
+#define TELEM_SRC_NAME(name) #name,
+
+static const char *SourceNames[TELEM_NUM_SOURCES] = {
+    TELEM_SOURCES(TELEM_SRC_NAME)
+};
+
+static const char *CodeNames[TELEM_NUM_CODES] = {
+    "TELEM_MTR_RANGE",
+    "TELEM_TW_BAND",
+};
+
+static const char *TypeName(uint8_t source, uint8_t type) {
+    if (TELEM_SRC_Robot == source) {
+        return (type < TELEM_NUM_CODES) ? CodeNames[type] : "?";
+    }
+    return (type < NUMBEROFEVENTS) ? EventNames[type] : "?";
+}
+
+int main(int argc, char **argv) {
+    uint8_t buf[TELEM_FRAME_LEN];
+    uint8_t have = 0;
+    uint8_t csv = 0;
+    uint32_t frames = 0;
+    uint32_t skipped = 0;
+    FILE *in = stdin;
+    int c;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (0 == strcmp(argv[i], "-c")) {
+            csv = 1;
+        } else if (!(in = fopen(argv[i], "rb"))) {
+            perror(argv[i]);
+            return 1;
+        }
+    }
+    if (csv) {
+        printf("time_ms,source,type,param,state\n");
+    }
+
+    while ((c = fgetc(in)) != EOF) {
+        uint32_t time_ms;
+        uint16_t param;
+        uint8_t sum = 0;
+
+        buf[have++] = c;
+        if (have < TELEM_FRAME_LEN) {
+            continue;
+        }
+        for (i = 1; i < TELEM_FRAME_LEN - 1; i++) {
+            sum += buf[i];
+        }
+        if ((TELEM_SYNC != buf[0]) || (sum != buf[TELEM_FRAME_LEN - 1])) {
+            //not a frame, drop one byte and try again from the next
+            memmove(buf, buf + 1, TELEM_FRAME_LEN - 1);
+            have--;
+            skipped++;
+            continue;
+        }
+        have = 0;
+        frames++;
+
+        time_ms = buf[1] | (buf[2] << 8) | (buf[3] << 16) | ((uint32_t) buf[4] << 24);
+        param = buf[7] | (buf[8] << 8);
+        if (csv) {
+            printf("%u,%s,%s,%u,%u\n", time_ms,
+                    (buf[5] < TELEM_NUM_SOURCES) ? SourceNames[buf[5]] : "?",
+                    TypeName(buf[5], buf[6]), param, buf[9]);
+        } else {
+            printf("%8u ms  %-20s %-20s 0x%04X  state %u\n", time_ms,
+                    (buf[5] < TELEM_NUM_SOURCES) ? SourceNames[buf[5]] : "?",
+                    TypeName(buf[5], buf[6]), param, buf[9]);
+        }
+    }
+    fprintf(stderr, "%u frames, %u bytes skipped\n", frames, skipped + have);
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * File:   trace_replay.c
+ *
+ * Feeds an event trace dump (event_trace.h) back into the host build of
+ * RobotHSM and checks that every event leaves the machine in the same state
+ * and sub state as it did when it was recorded. The dump is read from a
+ * serial capture or a host run log, anything outside the TRACE lines is
+ * skipped:
+ *
+ *   ROBOT_HOST_TRACE=1 ./build/robot_host > match.log
+ *   ./build/trace_replay match.log
+ *
+ * The clock is moved to each record's time and the tape/bumper pins are set
+ * from its snapshot before the event is delivered, then RunRobotHSM is called
+ * directly, the ES_Run loop and the simulator are not used. Events the
+ * machine posts to itself are not delivered from the queue, the trace already
+ * holds them where they were delivered in the recorded run.
+ *
+ * Prints the first record that came out different and the number of
+ * differing records, exits 1 if there were any (2 if the dump cannot be
+ * replayed), so a logic change can be checked against a recorded match.
+ *
+ * Created on October 17, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "RobotHSM.h"
+#include "robot.h"
+#include "robot_hal.h"
+#include "event_trace.h"
+
+static Trace_Record_t *Records;
+static unsigned long NumRecords;
+
+static int Load(FILE *in) {
+    char line[160];
+    unsigned long count = 0;
+    unsigned long first = 0;
+    int inside = 0;
+
+    while (fgets(line, sizeof (line), in)) {
+        unsigned long v[9];
+
+        if (0 == strncmp(line, "TRACE END", 9)) {
+            return inside ? 0 : -1;
+        }
+        if (2 == sscanf(line, "TRACE %lu %lu", &count, &first)) {
+            if (first != 0) {
+                fprintf(stderr, "trace starts at event %lu, replay needs the dump to hold the ES_INIT "
+                        "of the match (dump sooner or raise TRACE_DEPTH)\n", first);
+                return -1;
+            }
+            Records = calloc(count ? count : 1, sizeof (Trace_Record_t));
+            NumRecords = 0;
+            inside = 1;
+            continue;
+        }
+        if (inside && (NumRecords < count)
+                && (9 == sscanf(line, "%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu", &v[0], &v[1], &v[2], &v[3], &v[4],
+                &v[5], &v[6], &v[7], &v[8]))) {
+            Trace_Record_t *r = &Records[NumRecords++];
+            r->time = v[0];
+            r->type = v[1];
+            r->param = v[2];
+            r->state = v[3];
+            r->sub = v[4];
+            r->next = v[5];
+            r->next_sub = v[6];
+            r->tape = v[7];
+            r->bumpers = v[8];
+        }
+    }
+    fprintf(stderr, "no complete TRACE dump found\n");
+    return -1;
+}
+
+int main(int argc, char **argv) {
+    FILE *in = stdin;
+    unsigned long mismatches = 0;
+    unsigned long i;
+
+    if (argc > 1) {
+        in = fopen(argv[1], "r");
+        if (!in) {
+            perror(argv[1]);
+            return 2;
+        }
+    }
+    if (Load(in) < 0) {
+        return 2;
+    }
+
+    //same bring up as TemplateES_Main.c, minus the simulator and ES_Run
+    Robot_Init();
+    if (ES_Initialize() != Success) {
+        fprintf(stderr, "ES_Initialize failed\n");
+        return 2;
+    }
+    Trace_Reset();
+
+    for (i = 0; i < NumRecords; i++) {
+        const Trace_Record_t *want = &Records[i];
+        const Trace_Record_t *got;
+        uint64_t at_us = (uint64_t) want->time * 1000;
+        ES_Event ThisEvent;
+
+        if (at_us > HAL_HostGetMicros()) {
+            HAL_HostAdvance(at_us - HAL_HostGetMicros());
+        }
+        HAL_HostSetTape(want->tape);
+        HAL_HostSetBumpers(want->bumpers);
+        ThisEvent.EventType = want->type;
+        ThisEvent.EventParam = want->param;
+        RunRobotHSM(ThisEvent);
+
+        got = Trace_Get(Trace_Count() - 1);
+        if ((got->state != want->state) || (got->sub != want->sub) || (got->next != want->next)
+                || (got->next_sub != want->next_sub)) {
+            if (0 == mismatches) {
+                printf("first difference at record %lu, %u ms, %s 0x%04X:\n", i, want->time,
+                        (want->type < NUMBEROFEVENTS) ? EventNames[want->type] : "?", want->param);
+                printf("  recorded state %u/%u -> %u/%u\n", want->state, want->sub, want->next, want->next_sub);
+                printf("  replayed state %u/%u -> %u/%u\n", got->state, got->sub, got->next, got->next_sub);
+            }
+            mismatches++;
+        }
+    }
+    printf("replayed %lu events, %lu differ\n", NumRecords, mismatches);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,328 @@
+/*
+ * File:   trackwire_bench.c
+ *
+ * Runs recorded track wire traces through the sequential test in
+ * trackwire_cal.c, driven the way CheckTrackWire drives it, and through the
+ * scheme it replaced (a two block average of each sensor in turn against the
+ * same calibrated band), and prints how long each took to find the wire and
+ * how often it claimed to with the wire out of range:
+ *
+ *   ROBOT_SIM_TRACK_WIRE_LOG=tw.csv ./build/robot_host > /dev/null
+ *   ./build/trackwire_bench [-n noise] tw.csv ...
+ *
+ * -n adds uniform noise of +-noise counts to every step of the traces, the
+ * sim's own ADC noise is only SIM_ADC_NOISE peak to peak.
+ *
+ * "make twbench" records a few seeds at a few ROBOT_SIM_TRACK_WIRE levels and
+ * runs them all.
+ *
+ * A trace line holds whether each sensor is in range of the wire and the
+ * reading it gives for one sim step. Each line is held for its step and
+ * scanned at HAL_ADC_SCAN_HZ like robot_hal_posix.c does, only the selected
+ * sensor is read, and after a switch the blocks inside the settle time are
+ * skipped like FirstSettledBlock does. A pass is a stretch with both sensors
+ * in range. A found in a pass, or up to BENCH_LATE_MS after it, detects the
+ * pass (latency from the start of the pass), a second one in the same pass
+ * is counted as extra, any other found is a false alarm. A lost in the middle
+ * of a pass is a drop.
+ *
+ * Created on October 17, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "robot_hal.h"
+#include "trackwire_cal.h"
+
+#define BENCH_SETTLE_BLOCKS 4 //TRACKWIRE_SWITCH_TIME (10 ms) in scan blocks
+#define BENCH_FIXED_BLOCKS 2 //blocks per reading of the replaced scheme
+#define BENCH_LATE_MS 50 //a found this long after a pass ended still counts for it
+#define BENCH_MAX_PASSES 256
+#define BLOCK_US (1000000 / HAL_ADC_SCAN_HZ * HAL_ADC_BLOCK_LEN)
+
+typedef struct {
+    uint32_t ms;
+    uint8_t near[TW_CAL_SENSORS];
+    uint16_t reading[TW_CAL_SENSORS];
+} TraceStep_t;
+
+typedef struct {
+    uint32_t start_ms;
+    uint32_t end_ms;
+    int32_t found_ms; //-1 until detected
+} Pass_t;
+
+typedef struct {
+    uint32_t found; //passes detected
+    uint32_t extra;
+    uint32_t false_alarms;
+    uint32_t drops;
+    uint64_t latency_sum;
+    uint32_t latency_max;
+    uint32_t blocks; //blocks read
+    uint32_t switches;
+} Result_t;
+
+static TraceStep_t *Steps;
+static uint32_t NumSteps;
+static uint32_t StepUs;
+static Pass_t Passes[BENCH_MAX_PASSES];
+static uint32_t NumPasses;
+static uint32_t OutOfRangeMs;
+static uint32_t rand_state = 1;
+
+static int16_t BenchNoise(int16_t amplitude) {
+    //xorshift32 like ArenaSim, the same noise for every run
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return (int16_t) (rand_state % (2 * amplitude + 1)) - amplitude;
+}
+
+static int Load(const char *path, int16_t noise) {
+    FILE *in = fopen(path, "r");
+    char line[80];
+    uint32_t size = 0;
+    uint32_t i;
+
+    if (!in) {
+        perror(path);
+        return -1;
+    }
+    NumSteps = 0;
+    while (fgets(line, sizeof (line), in)) {
+        unsigned ms, n0, n1, r0, r1;
+
+        if (5 != sscanf(line, "%u,%u,%u,%u,%u", &ms, &n0, &n1, &r0, &r1)) {
+            continue;
+        }
+        if (NumSteps == size) {
+            size = size ? 2 * size : 4096;
+            Steps = realloc(Steps, size * sizeof (TraceStep_t));
+        }
+        Steps[NumSteps].ms = ms;
+        Steps[NumSteps].near[0] = n0;
+        Steps[NumSteps].near[1] = n1;
+        Steps[NumSteps].reading[0] = r0;
+        Steps[NumSteps].reading[1] = r1;
+        for (i = 0; noise && (i < TW_CAL_SENSORS); i++) {
+            int32_t reading = Steps[NumSteps].reading[i] + BenchNoise(noise);
+            Steps[NumSteps].reading[i] = (reading < 0) ? 0 : (reading > 1023) ? 1023 : reading;
+        }
+        NumSteps++;
+    }
+    fclose(in);
+    //one line per physics step from the start of the match
+    if (NumSteps < 2) {
+        fprintf(stderr, "%s: no track wire trace\n", path);
+        return -1;
+    }
+    StepUs = (Steps[1].ms - Steps[0].ms) * 1000;
+
+    NumPasses = 0;
+    OutOfRangeMs = 0;
+    for (i = 1; i < NumSteps; i++) {
+        uint8_t both = Steps[i].near[0] && Steps[i].near[1];
+        uint8_t was = Steps[i - 1].near[0] && Steps[i - 1].near[1];
+
+        if (both && !was && (NumPasses < BENCH_MAX_PASSES)) {
+            Passes[NumPasses].start_ms = Steps[i].ms;
+            Passes[NumPasses].found_ms = -1;
+            NumPasses++;
+        }
+        if (both && NumPasses) {
+            Passes[NumPasses - 1].end_ms = Steps[i].ms;
+        } else if (!both) {
+            OutOfRangeMs += StepUs / 1000;
+        }
+    }
+    return 0;
+}
+
+//mean of the HAL_ADC_BLOCK_LEN scans of one sensor in a block
+static uint16_t BlockMean(uint8_t sensor, uint32_t block) {
+    uint64_t us = (uint64_t) block * BLOCK_US;
+    uint32_t sum = 0;
+    uint8_t i;
+
+    for (i = 0; i < HAL_ADC_BLOCK_LEN; i++) {
+        uint32_t step = us / StepUs;
+
+        if (step >= NumSteps) {
+            step = NumSteps - 1;
+        }
+        sum += Steps[step].reading[sensor];
+        us += 1000000 / HAL_ADC_SCAN_HZ;
+    }
+    return sum / HAL_ADC_BLOCK_LEN;
+}
+
+static void Report(Result_t *r, uint8_t found, uint32_t block) {
+    uint32_t ms = (uint64_t) (block + 1) * BLOCK_US / 1000; //the block is in once it has ended
+    uint32_t i;
+
+    for (i = 0; i < NumPasses; i++) {
+        if ((ms >= Passes[i].start_ms) && (ms <= Passes[i].end_ms + BENCH_LATE_MS)) {
+            break;
+        }
+    }
+    if (!found) {
+        if ((i < NumPasses) && (ms <= Passes[i].end_ms)) {
+            r->drops++;
+        }
+    } else if (i == NumPasses) {
+        r->false_alarms++;
+    } else if (Passes[i].found_ms >= 0) {
+        r->extra++;
+    } else {
+        Passes[i].found_ms = ms;
+        r->found++;
+        r->latency_sum += ms - Passes[i].start_ms;
+        if (ms - Passes[i].start_ms > r->latency_max) {
+            r->latency_max = ms - Passes[i].start_ms;
+        }
+    }
+}
+
+static void ClearPasses(void) {
+    uint32_t i;
+
+    for (i = 0; i < NumPasses; i++) {
+        Passes[i].found_ms = -1;
+    }
+}
+
+//TrackWireCal_Block, one block at a time, switching when it asks to
+static void RunSequential(Result_t *r) {
+    uint32_t num_blocks = (uint64_t) (NumSteps - 1) * StepUs / BLOCK_US;
+    TrackWireCal_t cal;
+    uint32_t block = 0;
+    uint8_t select = 0;
+
+    TrackWireCal_Init(&cal);
+    ClearPasses();
+    while (block < num_blocks) {
+        r->blocks++;
+        if (TrackWireCal_Block(&cal, BlockMean(select, block), block)) {
+            Report(r, cal.found, block);
+        }
+        block++;
+        if (cal.select != select) {
+            select = cal.select;
+            r->switches++;
+            block += BENCH_SETTLE_BLOCKS;
+        }
+    }
+}
+
+//BENCH_FIXED_BLOCKS average of each sensor in turn against the calibrated
+//band, the last state of the other sensor counts however old it is
+static void RunFixed(Result_t *r) {
+    uint32_t num_blocks = (uint64_t) (NumSteps - 1) * StepUs / BLOCK_US;
+    TrackWireCal_t cal;
+    uint32_t block = 0;
+    uint8_t state[TW_CAL_SENSORS] = {0};
+    uint8_t select = 0;
+    uint8_t found = 0;
+
+    TrackWireCal_Init(&cal);
+    ClearPasses();
+    while (block + BENCH_FIXED_BLOCKS <= num_blocks) {
+        TrackWireCal_Sensor_t *s = &cal.sensor[select];
+        uint32_t sum = 0;
+        uint16_t reading;
+        uint8_t i;
+
+        for (i = 0; i < BENCH_FIXED_BLOCKS; i++) {
+            sum += BlockMean(select, block + i);
+        }
+        reading = sum / BENCH_FIXED_BLOCKS;
+        block += BENCH_FIXED_BLOCKS;
+        r->blocks += BENCH_FIXED_BLOCKS;
+
+        //only the calibration is used, the sequential test is undone
+        TrackWireCal_Sample(&cal, select, reading);
+        if (!state[select] && s->lower && (reading > s->upper)) {
+            state[select] = 1;
+        } else if (state[select] && (reading < s->lower)) {
+            state[select] = 0;
+        }
+        s->on = state[select];
+        s->sum = 0;
+        s->tested = 0;
+        if ((state[0] && state[1]) != found) {
+            found = !found;
+            Report(r, found, block - 1);
+        }
+
+        select = !select;
+        r->switches++;
+        block += BENCH_SETTLE_BLOCKS;
+    }
+}
+
+static void Print(const char *name, const char *scheme, const Result_t *r, uint32_t passes, uint32_t out_ms,
+        uint32_t ms) {
+    printf("%-24s %-10s %3u/%-3u %6.1f %5u %5u %5u %5u %7.2f %7.1f\n", name, scheme, r->found, passes,
+            r->found ? (double) r->latency_sum / r->found : 0.0, r->latency_max, r->extra, r->false_alarms,
+            r->drops, out_ms ? r->false_alarms * 60000.0 / out_ms : 0.0, ms ? r->switches * 1000.0 / ms : 0.0);
+}
+
+static void Add(Result_t *total, const Result_t *r) {
+    total->found += r->found;
+    total->extra += r->extra;
+    total->false_alarms += r->false_alarms;
+    total->drops += r->drops;
+    total->latency_sum += r->latency_sum;
+    if (r->latency_max > total->latency_max) {
+        total->latency_max = r->latency_max;
+    }
+    total->blocks += r->blocks;
+    total->switches += r->switches;
+}
+
+int main(int argc, char **argv) {
+    Result_t total[2] = {
+        {0}
+    };
+    uint32_t total_passes = 0;
+    uint32_t total_out_ms = 0;
+    uint32_t total_ms = 0;
+    int16_t noise = 0;
+    int i = 1;
+
+    if ((argc > 2) && (0 == strcmp(argv[1], "-n"))) {
+        noise = atoi(argv[2]);
+        i = 3;
+    }
+    if (argc <= i) {
+        fprintf(stderr, "usage: %s [-n noise] trace.csv ...\n", argv[0]);
+        return 2;
+    }
+    printf("added noise +-%d\n", noise);
+    printf("found/passes, latency mean and max ms, extra founds in a pass, false alarms, drops in a pass,\n"
+            "false alarms per minute out of range, sensor switches per second\n");
+    printf("%-24s %-10s %7s %6s %5s %5s %5s %5s %7s %7s\n", "trace", "scheme", "found", "mean", "max", "extra",
+            "false", "drops", "fa/min", "sw/s");
+    for (; i < argc; i++) {
+        Result_t seq = {0};
+        Result_t fixed = {0};
+
+        if (Load(argv[i], noise) < 0) {
+            return 2;
+        }
+        RunSequential(&seq);
+        RunFixed(&fixed);
+        Print(argv[i], "sequential", &seq, NumPasses, OutOfRangeMs, Steps[NumSteps - 1].ms);
+        Print(argv[i], "fixed", &fixed, NumPasses, OutOfRangeMs, Steps[NumSteps - 1].ms);
+        Add(&total[0], &seq);
+        Add(&total[1], &fixed);
+        total_passes += NumPasses;
+        total_out_ms += OutOfRangeMs;
+        total_ms += Steps[NumSteps - 1].ms;
+    }
+    Print("total", "sequential", &total[0], total_passes, total_out_ms, total_ms);
+    Print("total", "fixed", &total[1], total_passes, total_out_ms, total_ms);
+    return 0;
+}
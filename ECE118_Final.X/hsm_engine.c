@@ -0,0 +1,545 @@
+/*
+ * File:   hsm_engine.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include "BOARD.h"
+#include "hsm_engine.h"
+
+static ES_Event Recalled;
+static uint8_t RecallPending;
+static uint8_t Depth; //HSM_Dispatch calls in progress, a sub machine can be table driven too
+static uint8_t RecallDepth; //the HSM_Dispatch the recall was asked for in delivers it
+static uint8_t Initializing; //an ES_INIT is being dispatched somewhere up the call chain
+
+static void HSM_Exit(const HSM_State_t *State) {
+    ES_Event ThisEvent = EXIT_EVENT;
+
+    if (State->sub) {
+        State->sub(ThisEvent);
+    }
+    if (State->exit) {
+        State->exit();
+    }
+}
+
+static void HSM_Enter(const HSM_State_t *State) {
+    ES_Event ThisEvent = ENTRY_EVENT;
+
+    if (State->sub) {
+        State->sub(ThisEvent);
+    }
+    if (State->entry) {
+        State->entry();
+    }
+}
+
+static void HSM_Step(const HSM_Machine_t *Machine, uint8_t *CurrentState, ES_Event *ThisEvent) {
+    const HSM_State_t *State = &Machine->states[*CurrentState];
+    const HSM_Slot_t *Slot;
+    const HSM_Transition_t *Transition;
+    const HSM_Transition_t *End;
+
+    //from the parent machine entering or leaving the state this machine runs
+    //under, not consumed, same as the hand written sub HSMs
+    if (ES_ENTRY == ThisEvent->EventType) {
+        HSM_Enter(State);
+        return;
+    }
+    if (ES_EXIT == ThisEvent->EventType) {
+        HSM_Exit(State);
+        return;
+    }
+
+    if (State->sub) {
+        *ThisEvent = State->sub(*ThisEvent);
+    }
+    if ((ES_NO_EVENT == ThisEvent->EventType) || (ThisEvent->EventType >= NUMBEROFEVENTS)) {
+        return;
+    }
+
+    Slot = &Machine->slots[(uint16_t) (*CurrentState) * NUMBEROFEVENTS + ThisEvent->EventType];
+    Transition = &Machine->transitions[Slot->first];
+    End = Transition + Slot->count;
+    for (; Transition < End; Transition++) {
+        if (Transition->guard && !Transition->guard(ThisEvent)) {
+            continue;
+        }
+        //the action runs before the exit, same order as the hand written HSMs
+        if (Transition->action) {
+            Transition->action(ThisEvent);
+        }
+        if (HSM_NO_STATE != Transition->next) {
+            HSM_Exit(State);
+            *CurrentState = Transition->next;
+            HSM_Enter(&Machine->states[*CurrentState]);
+        }
+        ThisEvent->EventType = ES_NO_EVENT;
+        return;
+    }
+}
+
+void HSM_Dispatch(const HSM_Machine_t *Machine, uint8_t *CurrentState, ES_Event *ThisEvent) {
+    uint8_t recalls = 0;
+    uint8_t initializing = Initializing;
+
+    if (ES_INIT == ThisEvent->EventType) {
+        Initializing = TRUE;
+    }
+    Depth++;
+    HSM_Step(Machine, CurrentState, ThisEvent);
+    while (RecallPending && (RecallDepth == Depth)) {
+        RecallPending = FALSE;
+        if (recalls++ >= HSM_MAX_RECALLS) {
+            break;
+        }
+        *ThisEvent = Recalled;
+        HSM_Step(Machine, CurrentState, ThisEvent);
+    }
+    Depth--;
+    Initializing = initializing;
+}
+
+uint8_t HSM_Recall(ES_Event ThisEvent) {
+    if (RecallPending) {
+        return FALSE;
+    }
+    Recalled = ThisEvent;
+    RecallPending = TRUE;
+    RecallDepth = Depth;
+    return TRUE;
+}
+
+uint8_t HSM_Initializing(void) {
+    return Initializing;
+}
+
+uint8_t HSM_SubState(const HSM_Machine_t *Machine, uint8_t State) {
+    const HSM_State_t *S = &Machine->states[State];
+    return S->query ? S->query() : HSM_NO_STATE;
+}
+
+/*
+ * Host test harness, runs a small machine (pseudo state, two plain states and
+ * one with a sub machine) through a fixed event sequence, including an event
+ * handed over with HSM_Recall, checks the order of actions/hooks against the
+ * expected trace, does the same for a table driven machine nested in another,
+ * then times the table dispatch
+ * against the same machine written as a nested switch like the other HSMs:
+ *
+ *   gcc -O2 -DHSM_ENGINE_TEST -I<ECE118>/include -o hsm_test hsm_engine.c
+ */
+#ifdef HSM_ENGINE_TEST
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_NOW() __rdtsc()
+#define BENCH_UNIT "cycles"
+#else
+#define BENCH_NOW() BenchNanos()
+#define BENCH_UNIT "ns"
+
+static uint64_t BenchNanos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+#endif
+
+#define BENCH_ROUNDS 200000
+
+typedef enum {
+    TestInit, Idle, Running, Busy, TEST_NUM_STATES,
+} TestState_t;
+
+static char Trace[256];
+static uint8_t TraceOn = 1;
+static volatile uint32_t Work; //stands in for the motor calls so nothing is optimized out
+
+static void Log(const char *s) {
+    Work++;
+    if (TraceOn) {
+        strcat(Trace, s);
+        strcat(Trace, " ");
+    }
+}
+
+static uint8_t Busy_sub_consumes; //sub machine takes the next TAPE_CHANGED
+
+static ES_Event BusySub(ES_Event ThisEvent) {
+    if (ES_ENTRY == ThisEvent.EventType) {
+        Log("sub-entry");
+    } else if (ES_EXIT == ThisEvent.EventType) {
+        Log("sub-exit");
+    } else if ((TAPE_CHANGED == ThisEvent.EventType) && Busy_sub_consumes) {
+        Log("sub-tape");
+        ThisEvent.EventType = ES_NO_EVENT;
+    }
+    return ThisEvent;
+}
+
+static uint8_t ParamOdd(const ES_Event *ThisEvent) {
+    return (ThisEvent->EventParam & 1);
+}
+
+static void Start(ES_Event *ThisEvent) {
+    Log("start");
+}
+
+static void Go(ES_Event *ThisEvent) {
+    Log("go");
+}
+
+static void GoOdd(ES_Event *ThisEvent) {
+    Log("odd");
+}
+
+static void Tick(ES_Event *ThisEvent) {
+    Log("tick");
+}
+
+static void Stop(ES_Event *ThisEvent) {
+    Log("stop");
+}
+
+static void HandOver(ES_Event *ThisEvent) {
+    Log("hand");
+    HSM_Recall(*ThisEvent);
+}
+
+static void Caught(ES_Event *ThisEvent) {
+    Log("caught");
+}
+
+static void RunningEntry(void) {
+    Log("run-entry");
+}
+
+static void RunningExit(void) {
+    Log("run-exit");
+}
+
+static const HSM_State_t TestStates[TEST_NUM_STATES] = {
+    [TestInit] = {NULL, NULL, NULL},
+    [Idle] = {NULL, NULL, NULL},
+    [Running] = {RunningEntry, RunningExit, NULL},
+    [Busy] = {NULL, NULL, BusySub},
+};
+
+static const HSM_Transition_t TestTransitions[] = {
+    {NULL, Start, Idle}, //TestInit ES_INIT
+    {ParamOdd, GoOdd, Busy}, //Idle MANEUVER_OVER
+    {NULL, Go, Running}, //Idle MANEUVER_OVER
+    {NULL, Tick, HSM_NO_STATE}, //Running WAIT_OVER
+    {NULL, Stop, Busy}, //Running TAPE_CHANGED
+    {NULL, HandOver, Busy}, //Running BEACON_CHANGED
+    {NULL, Stop, Idle}, //Busy TAPE_CHANGED
+    {NULL, Caught, HSM_NO_STATE}, //Busy BEACON_CHANGED
+};
+
+static const HSM_Slot_t TestSlots[TEST_NUM_STATES][NUMBEROFEVENTS] = {
+    [TestInit][ES_INIT] = {0, 1},
+    [Idle][MANEUVER_OVER] = {1, 2},
+    [Running][WAIT_OVER] = {3, 1},
+    [Running][TAPE_CHANGED] = {4, 1},
+    [Running][BEACON_CHANGED] = {5, 1},
+    [Busy][TAPE_CHANGED] = {6, 1},
+    [Busy][BEACON_CHANGED] = {7, 1},
+};
+
+static const HSM_Machine_t TestMachine = {TestStates, &TestSlots[0][0], TestTransitions};
+
+//the same machine the way the other HSMs are written, the hand over is the
+//event run through again after the transition
+static TestState_t SwitchState = TestInit;
+static uint8_t SwitchRecall;
+
+static ES_Event RunSwitch(ES_Event ThisEvent) {
+    uint8_t makeTransition = FALSE;
+    TestState_t nextState;
+
+    switch (SwitchState) {
+        case TestInit:
+            if (ES_INIT == ThisEvent.EventType) {
+                Start(&ThisEvent);
+                nextState = Idle;
+                makeTransition = TRUE;
+                ThisEvent.EventType = ES_NO_EVENT;
+            }
+            break;
+        case Idle:
+            switch (ThisEvent.EventType) {
+                case MANEUVER_OVER:
+                    if (ThisEvent.EventParam & 1) {
+                        GoOdd(&ThisEvent);
+                        nextState = Busy;
+                    } else {
+                        Go(&ThisEvent);
+                        nextState = Running;
+                    }
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+                default:
+                    break;
+            }
+            break;
+        case Running:
+            switch (ThisEvent.EventType) {
+                case ES_ENTRY:
+                    RunningEntry();
+                    break;
+                case ES_EXIT:
+                    RunningExit();
+                    break;
+                case WAIT_OVER:
+                    Tick(&ThisEvent);
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+                case TAPE_CHANGED:
+                    Stop(&ThisEvent);
+                    nextState = Busy;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+                case BEACON_CHANGED:
+                    Log("hand");
+                    SwitchRecall = TRUE;
+                    nextState = Busy;
+                    makeTransition = TRUE;
+                    break;
+                default:
+                    break;
+            }
+            break;
+        case Busy:
+            ThisEvent = BusySub(ThisEvent);
+            switch (ThisEvent.EventType) {
+                case TAPE_CHANGED:
+                    Stop(&ThisEvent);
+                    nextState = Idle;
+                    makeTransition = TRUE;
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+                case BEACON_CHANGED:
+                    Caught(&ThisEvent);
+                    ThisEvent.EventType = ES_NO_EVENT;
+                    break;
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+    if (makeTransition == TRUE) {
+        RunSwitch(EXIT_EVENT);
+        SwitchState = nextState;
+        RunSwitch(ENTRY_EVENT);
+        if (SwitchRecall) {
+            SwitchRecall = FALSE;
+            ThisEvent = RunSwitch(ThisEvent);
+        }
+    }
+    return ThisEvent;
+}
+
+static const ES_Event TestEvents[] = {
+    {ES_INIT, 0},
+    {WAIT_OVER, 0}, //not handled in Idle
+    {MANEUVER_OVER, 2},
+    {WAIT_OVER, 0},
+    {TAPE_CHANGED, 0},
+    {TAPE_CHANGED, 1}, //consumed by the sub machine
+    {TAPE_CHANGED, 0},
+    {MANEUVER_OVER, 1},
+    {TAPE_CHANGED, 0},
+    {MANEUVER_OVER, 0},
+    {BEACON_CHANGED, 0}, //handed over to Busy
+};
+#define NUM_TEST_EVENTS (sizeof(TestEvents) / sizeof(TestEvents[0]))
+
+static const char Expected[] = "start go run-entry tick stop run-exit sub-entry sub-tape "
+        "stop sub-exit odd sub-entry stop sub-exit go run-entry hand run-exit sub-entry caught ";
+
+static void FeedTable(uint8_t *state) {
+    uint8_t i;
+    for (i = 0; i < NUM_TEST_EVENTS; i++) {
+        ES_Event e = TestEvents[i];
+        Busy_sub_consumes = (TAPE_CHANGED == e.EventType) && e.EventParam;
+        HSM_Dispatch(&TestMachine, state, &e);
+    }
+}
+
+static void FeedSwitch(void) {
+    uint8_t i;
+    SwitchState = TestInit;
+    for (i = 0; i < NUM_TEST_EVENTS; i++) {
+        ES_Event e = TestEvents[i];
+        Busy_sub_consumes = (TAPE_CHANGED == e.EventType) && e.EventParam;
+        RunSwitch(e);
+    }
+}
+
+//a table driven sub machine under a table driven parent: ES_ENTRY/ES_EXIT from
+//the parent reach the inner state hooks, and a recall is delivered by the
+//machine whose action asked for it
+typedef enum {
+    InnerInit, InA, InB, INNER_NUM_STATES,
+} InnerState_t;
+
+typedef enum {
+    OuterInit, Plain, Nest, OUTER_NUM_STATES,
+} OuterState_t;
+
+static uint8_t InnerState;
+
+static void AEntry(void) {
+    Log(HSM_Initializing() ? "a-init" : "a-entry");
+}
+
+static void AExit(void) {
+    Log("a-exit");
+}
+
+static void BEntry(void) {
+    Log("b-entry");
+}
+
+static void BExit(void) {
+    Log("b-exit");
+}
+
+static void NestEntry(void) {
+    Log("nest-entry");
+}
+
+static void OuterHand(ES_Event *ThisEvent) {
+    Log("outer-hand");
+    HSM_Recall(*ThisEvent);
+}
+
+static void OuterCaught(ES_Event *ThisEvent) {
+    Log("outer-caught");
+}
+
+static void InnerHand(ES_Event *ThisEvent) {
+    Log("inner-hand");
+    HSM_Recall(*ThisEvent);
+}
+
+static void InnerCaught(ES_Event *ThisEvent) {
+    Log("inner-caught");
+}
+
+static const HSM_State_t InnerStates[INNER_NUM_STATES] = {
+    [InnerInit] = {NULL, NULL, NULL},
+    [InA] = {AEntry, AExit, NULL},
+    [InB] = {BEntry, BExit, NULL},
+};
+
+static const HSM_Transition_t InnerTransitions[] = {
+    {NULL, NULL, InA}, //InnerInit ES_INIT
+    {NULL, InnerHand, InB}, //InA WAIT_OVER
+    {NULL, InnerCaught, HSM_NO_STATE}, //InB WAIT_OVER
+};
+
+static const HSM_Slot_t InnerSlots[INNER_NUM_STATES][NUMBEROFEVENTS] = {
+    [InnerInit][ES_INIT] = {0, 1},
+    [InA][WAIT_OVER] = {1, 1},
+    [InB][WAIT_OVER] = {2, 1},
+};
+
+static const HSM_Machine_t InnerMachine = {InnerStates, &InnerSlots[0][0], InnerTransitions};
+
+static ES_Event InnerRun(ES_Event ThisEvent) {
+    HSM_Dispatch(&InnerMachine, &InnerState, &ThisEvent);
+    return ThisEvent;
+}
+
+static const HSM_State_t OuterStates[OUTER_NUM_STATES] = {
+    [OuterInit] = {NULL, NULL, NULL},
+    [Plain] = {NULL, NULL, NULL},
+    [Nest] = {NestEntry, NULL, InnerRun},
+};
+
+static const HSM_Transition_t OuterTransitions[] = {
+    {NULL, NULL, Plain}, //OuterInit ES_INIT
+    {NULL, OuterHand, Nest}, //Plain BEACON_CHANGED
+    {NULL, OuterCaught, HSM_NO_STATE}, //Nest BEACON_CHANGED
+    {NULL, Stop, Plain}, //Nest TAPE_CHANGED
+};
+
+static const HSM_Slot_t OuterSlots[OUTER_NUM_STATES][NUMBEROFEVENTS] = {
+    [OuterInit][ES_INIT] = {0, 1},
+    [Plain][BEACON_CHANGED] = {1, 1},
+    [Nest][BEACON_CHANGED] = {2, 1},
+    [Nest][TAPE_CHANGED] = {3, 1},
+};
+
+static const HSM_Machine_t OuterMachine = {OuterStates, &OuterSlots[0][0], OuterTransitions};
+
+static const ES_Event NestedEvents[] = {
+    {ES_INIT, 0},
+    {BEACON_CHANGED, 0}, //handed over by the outer action, the inner machine being entered leaves it alone
+    {WAIT_OVER, 0}, //handed over inside the inner machine
+    {TAPE_CHANGED, 0},
+};
+
+static const char NestedExpected[] = "a-init outer-hand a-entry nest-entry outer-caught "
+        "inner-hand a-exit b-entry inner-caught stop b-exit ";
+
+static uint8_t RunNested(void) {
+    uint8_t outer = OuterInit;
+    ES_Event e = INIT_EVENT;
+    uint8_t i;
+
+    Trace[0] = '\0';
+    InnerState = InnerInit;
+    InnerRun(e);
+    for (i = 0; i < sizeof(NestedEvents) / sizeof(NestedEvents[0]); i++) {
+        e = NestedEvents[i];
+        HSM_Dispatch(&OuterMachine, &outer, &e);
+    }
+    printf("nested: %s\n", Trace);
+    return (0 == strcmp(Trace, NestedExpected)) && (Plain == outer);
+}
+
+int main(void) {
+    uint8_t state = TestInit;
+    int ok = 1;
+    uint64_t t0;
+    double table_cost;
+    double switch_cost;
+    long i;
+
+    FeedTable(&state);
+    printf("table : %s\n", Trace);
+    ok &= (0 == strcmp(Trace, Expected)) && (Busy == state);
+    Trace[0] = '\0';
+    FeedSwitch();
+    printf("switch: %s\n", Trace);
+    ok &= (0 == strcmp(Trace, Expected));
+    ok &= RunNested();
+
+    TraceOn = 0;
+    t0 = BENCH_NOW();
+    for (i = 0; i < BENCH_ROUNDS; i++) {
+        state = TestInit;
+        FeedTable(&state);
+    }
+    table_cost = (double) (BENCH_NOW() - t0) / (BENCH_ROUNDS * NUM_TEST_EVENTS);
+    t0 = BENCH_NOW();
+    for (i = 0; i < BENCH_ROUNDS; i++) {
+        FeedSwitch();
+    }
+    switch_cost = (double) (BENCH_NOW() - t0) / (BENCH_ROUNDS * NUM_TEST_EVENTS);
+    printf("per event (%s): table %.1f, nested switch %.1f\n", BENCH_UNIT, table_cost, switch_cost);
+
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+#endif
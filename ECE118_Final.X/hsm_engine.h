@@ -0,0 +1,104 @@
+/*
+ * File:   hsm_engine.h
+ *
+ * Table driven state machine engine. A machine is a set of const tables (in
+ * flash on the PIC32) generated by host/hsm_gen from a text spec, see
+ * RobotHSM.hsm for the format:
+ *
+ *   states      - entry/exit hooks and an optional sub machine Run function
+ *   slots       - [state][event] -> first transition and count, so finding the
+ *                 candidates for an event is one array index
+ *   transitions - guard, action, next state, tried in spec order
+ *
+ * HSM_Dispatch runs the sub machine of the current state first (same as the
+ * hand written HSMs) and matches whatever it hands back. The first transition
+ * whose guard passes runs its action, then the source state's exit and the
+ * target's entry, and the event is consumed. No recursion and the event is
+ * passed by pointer.
+ *
+ * HSM_Recall replaces re-posting the triggering event to our own queue so the
+ * state being entered sees it. An action (or a sub machine) hands the event
+ * back and HSM_Dispatch delivers it again once the exit/entry is done, in the
+ * same Run call. Nothing else can get in between and there is no queue slot
+ * to run out of.
+ *
+ * A sub machine can be table driven as well (AtTowerSubHSM.hsm). Its Run
+ * function calls HSM_Dispatch from inside the parent's, an ES_ENTRY/ES_EXIT
+ * from the parent enters/exits its current state (sub machine and hook). A
+ * recall is delivered by the HSM_Dispatch it was asked for in, so one made by
+ * the parent's action is not taken by the sub machine being entered.
+ *
+ * The tables are there to make the machines easier to read and change, not
+ * to make them faster. A transition is one line of the spec instead of a case
+ * block, and the action/exit/entry order is written once, here, instead of
+ * in every Run function. RunRobotHSM and RunAtTowerSubHSM cost the same
+ * either way: wrapped in rdtsc and run over sim seeds 1-8 on the host, the
+ * switch and the table versions came out within 3% of each other, in both
+ * directions (~86 and ~58 cycles per call).
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef HSM_ENGINE_H
+#define	HSM_ENGINE_H
+
+#include "ES_Configure.h"
+#include "ES_Events.h"
+
+/*** MACROS ***/
+#define HSM_NO_STATE 0xFF //next state of an internal transition, no exit/entry
+#define HSM_MAX_RECALLS 4 //per HSM_Dispatch, stops two states handing an event back and forth forever
+
+/*** TYPEDEFS ***/
+typedef uint8_t(*HSM_GuardFunc)(const ES_Event *ThisEvent);
+typedef void (*HSM_ActionFunc)(ES_Event *ThisEvent);
+typedef void (*HSM_HookFunc)(void);
+typedef ES_Event(*HSM_SubFunc)(ES_Event ThisEvent);
+typedef uint8_t(*HSM_QueryFunc)(void);
+
+typedef struct {
+    HSM_GuardFunc guard; //NULL always passes
+    HSM_ActionFunc action; //may be NULL
+    uint8_t next; //HSM_NO_STATE to stay put
+} HSM_Transition_t;
+
+typedef struct {
+    uint8_t first; //index into the transitions
+    uint8_t count; //0 if the state does not handle the event
+} HSM_Slot_t;
+
+typedef struct {
+    HSM_HookFunc entry;
+    HSM_HookFunc exit;
+    HSM_SubFunc sub; //gets every event first, and ES_ENTRY/ES_EXIT of this state
+    HSM_QueryFunc query; //current state of the sub machine, may be NULL
+} HSM_State_t;
+
+typedef struct {
+    const HSM_State_t *states;
+    const HSM_Slot_t *slots; //NUMBEROFEVENTS per state
+    const HSM_Transition_t *transitions;
+} HSM_Machine_t;
+
+/*** Function Headers ***/
+
+//ThisEvent is set to ES_NO_EVENT when a transition took it. State 0 is the
+//initial pseudo state, its ES_INIT transition enters the real initial state.
+void HSM_Dispatch(const HSM_Machine_t *Machine, uint8_t *CurrentState, ES_Event *ThisEvent);
+
+//Deliver ThisEvent again after the current dispatch step, to whatever state
+//the machine is in by then, the machine being the innermost table driven one
+//running. One event can be held, returns FALSE if one is already waiting.
+//Only valid from inside HSM_Dispatch (actions, hooks and the sub machines it
+//calls).
+uint8_t HSM_Recall(ES_Event ThisEvent);
+
+//TRUE while an ES_INIT is being dispatched, by this HSM_Dispatch or one it
+//was called from. The init transitions deliver ES_ENTRY too, entry code that
+//should only run when the robot really gets to the state checks this.
+uint8_t HSM_Initializing(void);
+
+//State of the sub machine of State, HSM_NO_STATE if it has none or no query
+uint8_t HSM_SubState(const HSM_Machine_t *Machine, uint8_t State);
+
+#endif	/* HSM_ENGINE_H */
@@ -0,0 +1,158 @@
+/*
+ * File:   loop_profiler.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include "ES_Configure.h"
+
+#ifdef USE_PROFILER
+#include <stdio.h>
+#include "ES_Framework.h"
+#include "RobotHSM.h"
+#include "robot_services.h"
+#include "robot_hal.h"
+#include "loop_profiler.h"
+#include "queue_stats.h"
+#include "Bot_EventCheckers.h"
+#include "event_trace.h"
+
+/*** TYPEDEFS ***/
+#define PROF_SLOT(fn) PROF_SLOT_##fn,
+
+typedef enum {
+    PROF_CHECKERS(PROF_SLOT)
+    PROF_SLOT_RunKeyboardInput,
+    PROF_SERVICES(PROF_SLOT)
+    PROF_NUM_SLOTS,
+} Prof_Slot_t;
+
+typedef struct {
+    uint32_t calls;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t hist[PROF_HIST_BUCKETS];
+} Prof_Stats_t;
+
+/*** Module Variables ***/
+#define PROF_NAME(fn) #fn,
+
+static const char * const ProfNames[PROF_NUM_SLOTS] = {
+    PROF_CHECKERS(PROF_NAME)
+    "RunKeyboardInput",
+    PROF_SERVICES(PROF_NAME)
+};
+
+static Prof_Stats_t ProfStats[PROF_NUM_SLOTS];
+
+/*** Private Functions ***/
+
+static void Prof_Record(Prof_Slot_t slot, uint32_t cycles) {
+    Prof_Stats_t *s = &ProfStats[slot];
+    uint8_t bucket = 31 - __builtin_clz(cycles | 1); //floor(log2), one instruction on the MIPS core
+
+    if ((0 == s->calls) || (cycles < s->min)) {
+        s->min = cycles;
+    }
+    if (cycles > s->max) {
+        s->max = cycles;
+    }
+    s->calls++;
+    s->total += cycles;
+    s->hist[(bucket < PROF_HIST_BUCKETS) ? bucket : (PROF_HIST_BUCKETS - 1)]++;
+}
+
+/*** Wrappers ***/
+#define PROF_WRAP_CHECKER(fn) \
+uint8_t Prof_##fn(void) { \
+    uint32_t start = HAL_ReadCycles(); \
+    uint8_t returnVal = fn(); \
+    Prof_Record(PROF_SLOT_##fn, HAL_ReadCycles() - start); \
+    return returnVal; \
+}
+
+#define PROF_WRAP_SERVICE(fn) \
+ES_Event Prof_##fn(ES_Event ThisEvent) { \
+    uint32_t start = HAL_ReadCycles(); \
+    ES_Event returnEvent = fn(ThisEvent); \
+    Prof_Record(PROF_SLOT_##fn, HAL_ReadCycles() - start); \
+    return returnEvent; \
+}
+
+PROF_CHECKERS(PROF_WRAP_CHECKER)
+PROF_SERVICES(PROF_WRAP_SERVICE)
+
+ES_Event Prof_RunKeyboardInput(ES_Event ThisEvent) {
+    uint32_t start;
+    ES_Event returnEvent;
+
+    //the profiler keys are eaten here, everything else goes on to the event parser
+    if (ES_KEYINPUT == ThisEvent.EventType) {
+        if (PROF_DUMP_KEY == ThisEvent.EventParam) {
+            Prof_Dump();
+            returnEvent.EventType = ES_NO_EVENT;
+            return returnEvent;
+        }
+        if (PROF_QUEUE_KEY == ThisEvent.EventParam) {
+            QStat_Dump();
+            Tape_PrintFilterStats();
+            TrackWire_PrintBand();
+            returnEvent.EventType = ES_NO_EVENT;
+            return returnEvent;
+        }
+        if (PROF_TRACE_KEY == ThisEvent.EventParam) {
+            Trace_Dump();
+            returnEvent.EventType = ES_NO_EVENT;
+            return returnEvent;
+        }
+        if (PROF_RESET_KEY == ThisEvent.EventParam) {
+            Prof_Dump();
+            Prof_Reset();
+            returnEvent.EventType = ES_NO_EVENT;
+            return returnEvent;
+        }
+    }
+    start = HAL_ReadCycles();
+    returnEvent = RunKeyboardInput(ThisEvent);
+    Prof_Record(PROF_SLOT_RunKeyboardInput, HAL_ReadCycles() - start);
+    return returnEvent;
+}
+
+/*** Public Functions ***/
+
+void Prof_Dump(void) {
+    uint8_t i;
+    uint8_t b;
+
+    printf("\r\nPROFILE (cycles, %d per us), histogram is log2(cycles):calls\r\n", HAL_CYCLES_PER_US);
+    printf("%-26s %10s %8s %8s %8s  %s\r\n", "function", "calls", "min", "mean", "max", "histogram");
+    for (i = 0; i < PROF_NUM_SLOTS; i++) {
+        Prof_Stats_t *s = &ProfStats[i];
+        printf("%-26s %10lu %8lu %8lu %8lu ", ProfNames[i], (unsigned long) s->calls, (unsigned long) s->min,
+                (unsigned long) (s->calls ? (s->total / s->calls) : 0), (unsigned long) s->max);
+        for (b = 0; b < PROF_HIST_BUCKETS; b++) {
+            if (s->hist[b]) {
+                printf(" %u:%lu", b, (unsigned long) s->hist[b]);
+            }
+        }
+        printf("\r\n");
+    }
+}
+
+void Prof_Reset(void) {
+    uint8_t i;
+    uint8_t b;
+
+    for (i = 0; i < PROF_NUM_SLOTS; i++) {
+        ProfStats[i].calls = 0;
+        ProfStats[i].min = 0;
+        ProfStats[i].max = 0;
+        ProfStats[i].total = 0;
+        for (b = 0; b < PROF_HIST_BUCKETS; b++) {
+            ProfStats[i].hist[b] = 0;
+        }
+    }
+}
+
+#endif /* USE_PROFILER */
@@ -0,0 +1,60 @@
+/*
+ * File:   loop_profiler.h
+ *
+ * Execution time profile of the ES_Run loop. With USE_PROFILER defined in
+ * ES_Configure.h the EVENT_CHECK_LIST entries and the SERV_n_RUN functions go
+ * through the Prof_* wrappers below (see PROFILED), which time every call with
+ * HAL_ReadCycles and keep count, min, max, mean and a log2 histogram per
+ * function. The table is printed on a keypress through ES_KeyboardInput:
+ *
+ *   PROF_DUMP_KEY  - print the table
+ *   PROF_RESET_KEY - print the table and start over
+ *   PROF_QUEUE_KEY - print the event queue table (queue_stats.h), the
+ *                    tape filter counts (tape_filter.h) and the track wire
+ *                    bands (trackwire_cal.h)
+ *   PROF_TRACE_KEY - print the RobotHSM event trace (event_trace.h)
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef LOOP_PROFILER_H
+#define	LOOP_PROFILER_H
+
+#include "ES_Configure.h"
+#include "ES_Events.h"
+#include "ES_KeyboardInput.h" //SERV_0_HEADER is this file when profiling
+#include "Bot_EventCheckers.h" //EVENT_CHECK_HEADER is this file when profiling
+
+/*** MACROS ***/
+#define PROF_HIST_BUCKETS 20 //bucket b counts calls of 2^b to 2^(b+1) - 1 cycles, the last one everything longer
+#define PROF_DUMP_KEY 'p' //not a hex digit, so it never collides with keyboard event entry
+#define PROF_RESET_KEY 'P'
+#define PROF_QUEUE_KEY 'q'
+#define PROF_TRACE_KEY 't'
+
+//everything that is timed, has to match EVENT_CHECK_LIST and SERV_n_RUN
+#define PROF_CHECKERS(X) \
+    X(CheckBattery) \
+    X(CheckTape) \
+    X(CheckBumper) \
+    X(CheckBeacon) \
+    X(CheckTrackWire) \
+    X(CheckSolenoid)
+
+//RunKeyboardInput is timed as well, its wrapper is written out because it
+//also catches the profiler keys
+#define PROF_SERVICES(X) \
+    X(RunRobotHSM) \
+    X(RunVelocityService)
+
+/*** Function Headers ***/
+#define PROF_DECLARE_CHECKER(fn) uint8_t Prof_##fn(void);
+#define PROF_DECLARE_SERVICE(fn) ES_Event Prof_##fn(ES_Event ThisEvent);
+PROF_CHECKERS(PROF_DECLARE_CHECKER)
+PROF_SERVICES(PROF_DECLARE_SERVICE)
+ES_Event Prof_RunKeyboardInput(ES_Event ThisEvent);
+
+void Prof_Dump(void); //prints the table with printf
+void Prof_Reset(void);
+
+#endif	/* LOOP_PROFILER_H */
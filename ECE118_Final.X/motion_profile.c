@@ -0,0 +1,266 @@
+/*
+ * File:   motion_profile.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include "motion_profile.h"
+
+/*** MACROS ***/
+#define CREEP_STEPS 4 //steps of the distance left to cover at vmin
+
+/*** Private Functions ***/
+
+static uint32_t Profile_Sqrt(uint64_t x) {
+    uint64_t bit = (uint64_t) 1 << 62;
+    uint64_t root = 0;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (x >= root + bit) {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+//ticks it takes to stop from v (ticks/s) with the acceleration now at acc,
+//ramping any acceleration out and the deceleration in and out at the jerk
+//limit. A speed too low to reach the full deceleration stops in
+//v * sqrt(v / jerk)
+static int32_t Profile_StopDistance(const Profile_t *p, int32_t v) {
+    int64_t a = p->lim.accel;
+    int64_t j = p->lim.jerk;
+    int64_t v_eff = v;
+    int64_t ramp_out = 0;
+
+    if (p->acc > 0) {
+        //speed and distance still gained while the acceleration ramps out
+        v_eff += (int64_t) p->acc * p->acc / (2 * j);
+        ramp_out = v * p->acc / j + (int64_t) p->acc * p->acc / j * p->acc / (3 * j);
+    }
+    if (v_eff * j >= a * a) {
+        return ramp_out + v_eff * v_eff / (2 * a) + v_eff * a / (2 * j);
+    }
+    return ramp_out + Profile_Sqrt(v_eff * v_eff * v_eff / j);
+}
+
+//largest acceleration that can be applied for this step and still be ramped
+//out, one jerk step at a time, before the speed has changed by dv (ticks/s
+//* 1000, like vel, so the truncated speed does not throw it off). Solves
+//a^2 / 2j + a * dt / 2 = dv, the second term is the steps being discrete. A
+//ramp that does not end on a whole jerk step gains up to j * dt^2 / 8 more,
+//that is taken off dv first
+static int32_t Profile_RampLimit(const Profile_t *p, int32_t dv, uint16_t dt_ms) {
+    int64_t half_step = (int64_t) p->lim.jerk * dt_ms / 2000;
+
+    dv -= (int64_t) p->lim.jerk * dt_ms * dt_ms / 8000;
+    if (dv <= 0) {
+        return 0;
+    }
+    return Profile_Sqrt(half_step * half_step + (int64_t) 2 * p->lim.jerk * dv / 1000) - half_step;
+}
+
+/*** Public Functions ***/
+
+void Profile_Init(Profile_t *p, int32_t distance, int32_t v_start, const Profile_Limits_t *lim) {
+    p->lim = *lim;
+    p->distance = distance;
+    if (v_start > lim->vmax) {
+        v_start = lim->vmax;
+    }
+    p->vel = v_start * 1000;
+    p->acc = 0;
+    p->done = (distance <= 0);
+}
+
+int32_t Profile_Step(Profile_t *p, int32_t travelled, uint16_t dt_ms) {
+    int32_t remaining = p->distance - travelled;
+    int32_t v = p->vel / 1000;
+    int32_t want;
+    int32_t jerk_step = p->lim.jerk * dt_ms / 1000;
+    int32_t creep = p->lim.vmin * CREEP_STEPS * dt_ms / 1000;
+
+    if (p->done || (remaining <= 0)) {
+        p->done = 1;
+        p->vel = 0;
+        p->acc = 0;
+        return 0;
+    }
+
+    if ((v > 0) && (Profile_StopDistance(p, v) + creep >= remaining)) {
+        //the deceleration that gets down to vmin a few creep steps short of
+        //the distance, re-planned every step from the measured travel and
+        //eased out as the speed nears vmin
+        int32_t left = (remaining > creep) ? remaining - creep : 1;
+        want = -(int32_t) (((int64_t) v * v - (int64_t) p->lim.vmin * p->lim.vmin) / (2 * left));
+        if (want < -Profile_RampLimit(p, p->vel - p->lim.vmin * 1000, dt_ms)) {
+            want = -Profile_RampLimit(p, p->vel - p->lim.vmin * 1000, dt_ms);
+        }
+    } else {
+        //full acceleration, eased out so the speed levels off on vmax
+        want = Profile_RampLimit(p, p->lim.vmax * 1000 - p->vel, dt_ms);
+    }
+    if (want > p->lim.accel) {
+        want = p->lim.accel;
+    } else if (want < -p->lim.accel) {
+        want = -p->lim.accel;
+    }
+
+    if (want > p->acc + jerk_step) {
+        p->acc += jerk_step;
+    } else if (want < p->acc - jerk_step) {
+        p->acc -= jerk_step;
+    } else {
+        p->acc = want;
+    }
+    p->vel += p->acc * dt_ms;
+
+    if (p->vel > p->lim.vmax * 1000) {
+        p->vel = p->lim.vmax * 1000;
+        if (p->acc > 0) {
+            p->acc = 0;
+        }
+    } else if ((p->acc < 0) && (p->vel < p->lim.vmin * 1000)) {
+        p->vel = p->lim.vmin * 1000; //creep the rest of the way
+        p->acc = 0;
+    }
+    return p->vel / 1000;
+}
+
+uint8_t Profile_Done(const Profile_t *p) {
+    return p->done;
+}
+
+uint32_t Profile_MinTimeMs(int32_t distance, const Profile_Limits_t *lim) {
+    //cruise time plus one full ramp up and down, on the long side for short moves
+    return (uint32_t) ((int64_t) distance * 1000 / lim->vmax + (int64_t) lim->vmax * 1000 / lim->accel
+            + (int64_t) lim->accel * 1000 / lim->jerk);
+}
+
+/*
+ * Host test harness, steps profiles against an ideal plant (the wheels follow
+ * the setpoint exactly) and a first order one like ArenaSim's motors, and
+ * checks every step against the limits:
+ *
+ *   gcc -O2 -DMOTION_PROFILE_TEST -o motion_profile_test motion_profile.c
+ *
+ * The setpoint may only change by accel * dt per step and the acceleration by
+ * jerk * dt, except for the last step to 0. With the ideal plant that step has
+ * to be from about vmin (a move too short to settle on the creep speed may be a
+ * few ticks/s over) and the wheels have to stop within one creep step past the
+ * distance. The lagging wheels run ahead of the planned stop, their
+ * last setpoint ("stop" column) and the distance they coast to are reported.
+ */
+#ifdef MOTION_PROFILE_TEST
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_DT_MS 10 //VELOCITY_TIMER_TICKS
+#define TEST_TAU_MS 60 //SIM_MOTOR_TAU_MS
+#define TEST_MAX_STEPS 2000
+
+typedef struct {
+    const char *name;
+    int32_t distance;
+    int32_t vmax;
+    int32_t v_start;
+} ProfileCase_t;
+
+static const Profile_Limits_t TestLimits = {3300, 150, 12000, 150000};
+
+static const ProfileCase_t Cases[] = {
+    {"long", 20000, 3300, 0},
+    {"medium", 1700, 3300, 0},
+    {"short", 300, 3300, 0},
+    {"tiny", 20, 3300, 0},
+    {"slow", 2000, 800, 0},
+    {"turn 90 deg", 1514, 2475, 0}, //Units_TurnDegToTicks(90) at speed 75
+    {"moving start", 1500, 3300, 2640},
+    {"reversing start", 1130, 2640, -3300}, //the back-off after a bump at full speed
+};
+
+#define NUM_CASES (sizeof (Cases) / sizeof (Cases[0]))
+
+//runs one case, lag 0 is the ideal plant. Returns the number of limit violations
+static int RunCase(const ProfileCase_t *c, uint8_t lag) {
+    Profile_Limits_t lim = TestLimits;
+    Profile_t p;
+    int64_t pos = 0; //ticks * 1000
+    int64_t wheel = (int64_t) c->v_start * 1000; //plant speed, ticks/s * 1000
+    int32_t last_v = c->v_start;
+    int32_t stop_v = 0;
+    int32_t last_acc = 0;
+    int32_t peak_v = 0;
+    int32_t steps = 0;
+    int bad = 0;
+
+    lim.vmax = c->vmax;
+    Profile_Init(&p, c->distance, c->v_start, &lim);
+    while (!Profile_Done(&p) && (steps < TEST_MAX_STEPS)) {
+        int32_t v = Profile_Step(&p, pos / 1000, TEST_DT_MS);
+        int32_t dv = abs(v - last_v);
+        int32_t da = abs(p.acc - last_acc);
+
+        if (Profile_Done(&p)) {
+            stop_v = last_v;
+            if (!lag && (dv > lim.vmin + lim.vmin / 10)) {
+                bad++;
+            }
+        } else if ((v > lim.vmax) || (abs(p.acc) > lim.accel) || (da > lim.jerk * TEST_DT_MS / 1000)
+                || (dv > lim.accel * TEST_DT_MS / 1000)) {
+            bad++;
+        }
+        if (v > peak_v) {
+            peak_v = v;
+        }
+        last_v = v;
+        last_acc = p.acc;
+
+        if (lag) {
+            wheel += ((int64_t) v * 1000 - wheel) * TEST_DT_MS / TEST_TAU_MS;
+        } else {
+            wheel = (int64_t) v * 1000;
+        }
+        pos += wheel * TEST_DT_MS / 1000;
+        steps++;
+    }
+    if (!Profile_Done(&p)) {
+        bad++;
+    }
+    //the lagging wheels coast down after the last setpoint
+    while (lag && (wheel > 1000)) {
+        wheel -= wheel * TEST_DT_MS / TEST_TAU_MS;
+        pos += wheel * TEST_DT_MS / 1000;
+    }
+    if (!lag && ((pos / 1000 < c->distance) || (pos / 1000 > c->distance + lim.vmin * TEST_DT_MS / 1000 + 1))) {
+        bad++;
+    }
+
+    printf("%-16s %5s %6d %6d %6d %6d %6ld %6d %6u %s\n", c->name, lag ? "lag" : "ideal", c->distance, c->v_start,
+            peak_v, stop_v, (long) (pos / 1000), steps * TEST_DT_MS, Profile_MinTimeMs(c->distance, &lim),
+            bad ? "<-- FAIL" : "");
+    return bad;
+}
+
+int main(void) {
+    int bad = 0;
+    uint8_t i;
+
+    printf("limits: accel %d ticks/s^2, jerk %d ticks/s^3, creep %d ticks/s, %d ms steps\n",
+            TestLimits.accel, TestLimits.jerk, TestLimits.vmin, TEST_DT_MS);
+    printf("%-16s %5s %6s %6s %6s %6s %6s %6s %6s\n", "case", "plant", "dist", "v0", "peak", "stop", "moved", "ms", "est");
+    for (i = 0; i < NUM_CASES; i++) {
+        bad += RunCase(&Cases[i], 0);
+        bad += RunCase(&Cases[i], 1);
+    }
+    printf("%s\n", bad ? "FAIL" : "PASS");
+    return bad ? 1 : 0;
+}
+#endif
@@ -0,0 +1,52 @@
+/*
+ * File:   motion_profile.h
+ *
+ * Jerk limited trapezoidal velocity profile for one move along a path, in
+ * encoder ticks. Profile_Step is called at a fixed rate with the distance
+ * actually travelled so far and returns the velocity setpoint for the next
+ * period: acceleration ramps up at the jerk limit to the acceleration limit,
+ * the velocity levels off at the cruise speed, and the ramp down starts once
+ * the remaining distance is what it takes to stop from the current speed.
+ *
+ * The stop is planned from the measured distance, so a wheel that lags its
+ * setpoint just starts the ramp down later instead of stopping short. The
+ * last few ticks are covered at the creep speed vmin, the only velocity step
+ * left is from vmin to 0 when the distance is reached.
+ *
+ * Integer only and no state outside the Profile_t, so a profile steps the
+ * same on the PIC32 and the host. Build with MOTION_PROFILE_TEST defined for
+ * the host test at the bottom of motion_profile.c.
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef MOTION_PROFILE_H
+#define	MOTION_PROFILE_H
+
+#include <stdint.h>
+
+/*** Typedefs ***/
+typedef struct {
+    int32_t vmax; //cruise speed, ticks/s
+    int32_t vmin; //creep speed for the last ticks, ticks/s
+    int32_t accel; //ticks/s^2
+    int32_t jerk; //ticks/s^3
+} Profile_Limits_t;
+
+typedef struct {
+    Profile_Limits_t lim;
+    int32_t distance; //ticks, always positive, the caller maps the direction
+    int32_t vel; //setpoint in ticks/s * 1000, so small accelerations are not truncated
+    int32_t acc; //ticks/s^2
+    uint8_t done;
+} Profile_t;
+
+/*** Function Headers ***/
+//v_start is the speed the wheels already have along the move (negative if
+//they are going the other way), the profile starts from it instead of a step
+void Profile_Init(Profile_t *p, int32_t distance, int32_t v_start, const Profile_Limits_t *lim);
+int32_t Profile_Step(Profile_t *p, int32_t travelled, uint16_t dt_ms); //returns ticks/s
+uint8_t Profile_Done(const Profile_t *p);
+uint32_t Profile_MinTimeMs(int32_t distance, const Profile_Limits_t *lim); //from rest to rest, for timeouts
+
+#endif	/* MOTION_PROFILE_H */
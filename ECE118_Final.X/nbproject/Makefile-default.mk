@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=robot.c Bot_EventCheckers.c RobotHSM.c TowardsTowerSubHSM.c robot_services.c C:/ECE118/src/AD.c C:/ECE118/src/BOARD.c C:/ECE118/src/ES_CheckEvents.c C:/ECE118/src/ES_Framework.c C:/ECE118/src/ES_KeyboardInput.c C:/ECE118/src/ES_PostList.c C:/ECE118/src/ES_Queue.c C:/ECE118/src/ES_TattleTale.c C:/ECE118/src/ES_Timers.c C:/ECE118/src/IO_Ports.c C:/ECE118/src/LED.c C:/ECE118/src/pwm.c C:/ECE118/src/serial.c C:/ECE118/src/timers.c TemplateES_Main.c AtTowerSubHSM.c TapeSubState.c TraverseSubHSM.c TowerAlignSubHSM.c TowerTraverseSubHSM.c TowerShootSubHSM.c
+SOURCEFILES_QUOTED_IF_SPACED=robot.c Bot_EventCheckers.c RobotHSM.c TowardsTowerSubHSM.c robot_services.c C:/ECE118/src/AD.c C:/ECE118/src/BOARD.c C:/ECE118/src/ES_CheckEvents.c C:/ECE118/src/ES_Framework.c C:/ECE118/src/ES_KeyboardInput.c C:/ECE118/src/ES_PostList.c C:/ECE118/src/ES_Queue.c C:/ECE118/src/ES_TattleTale.c C:/ECE118/src/ES_Timers.c C:/ECE118/src/IO_Ports.c C:/ECE118/src/LED.c C:/ECE118/src/pwm.c C:/ECE118/src/serial.c C:/ECE118/src/timers.c TemplateES_Main.c AtTowerSubHSM.c TapeSubState.c TraverseSubHSM.c TowerAlignSubHSM.c TowerTraverseSubHSM.c TowerShootSubHSM.c robot_hal_pic32.c fixed_math.c beacon_goertzel.c robot_units.c loop_profiler.c hsm_engine.c queue_stats.c tape_filter.c telemetry.c event_trace.c motion_profile.c trackwire_cal.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/robot.o ${OBJECTDIR}/Bot_EventCheckers.o ${OBJECTDIR}/RobotHSM.o ${OBJECTDIR}/TowardsTowerSubHSM.o ${OBJECTDIR}/robot_services.o ${OBJECTDIR}/_ext/1975241074/AD.o ${OBJECTDIR}/_ext/1975241074/BOARD.o ${OBJECTDIR}/_ext/1975241074/ES_CheckEvents.o ${OBJECTDIR}/_ext/1975241074/ES_Framework.o ${OBJECTDIR}/_ext/1975241074/ES_KeyboardInput.o ${OBJECTDIR}/_ext/1975241074/ES_PostList.o ${OBJECTDIR}/_ext/1975241074/ES_Queue.o ${OBJECTDIR}/_ext/1975241074/ES_TattleTale.o ${OBJECTDIR}/_ext/1975241074/ES_Timers.o ${OBJECTDIR}/_ext/1975241074/IO_Ports.o ${OBJECTDIR}/_ext/1975241074/LED.o ${OBJECTDIR}/_ext/1975241074/pwm.o ${OBJECTDIR}/_ext/1975241074/serial.o ${OBJECTDIR}/_ext/1975241074/timers.o ${OBJECTDIR}/TemplateES_Main.o ${OBJECTDIR}/AtTowerSubHSM.o ${OBJECTDIR}/TapeSubState.o ${OBJECTDIR}/TraverseSubHSM.o ${OBJECTDIR}/TowerAlignSubHSM.o ${OBJECTDIR}/TowerTraverseSubHSM.o ${OBJECTDIR}/TowerShootSubHSM.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/robot.o.d ${OBJECTDIR}/Bot_EventCheckers.o.d ${OBJECTDIR}/RobotHSM.o.d ${OBJECTDIR}/TowardsTowerSubHSM.o.d ${OBJECTDIR}/robot_services.o.d ${OBJECTDIR}/_ext/1975241074/AD.o.d ${OBJECTDIR}/_ext/1975241074/BOARD.o.d ${OBJECTDIR}/_ext/1975241074/ES_CheckEvents.o.d ${OBJECTDIR}/_ext/1975241074/ES_Framework.o.d ${OBJECTDIR}/_ext/1975241074/ES_KeyboardInput.o.d ${OBJECTDIR}/_ext/1975241074/ES_PostList.o.d ${OBJECTDIR}/_ext/1975241074/ES_Queue.o.d ${OBJECTDIR}/_ext/1975241074/ES_TattleTale.o.d ${OBJECTDIR}/_ext/1975241074/ES_Timers.o.d ${OBJECTDIR}/_ext/1975241074/IO_Ports.o.d ${OBJECTDIR}/_ext/1975241074/LED.o.d ${OBJECTDIR}/_ext/1975241074/pwm.o.d ${OBJECTDIR}/_ext/1975241074/serial.o.d ${OBJECTDIR}/_ext/1975241074/timers.o.d ${OBJECTDIR}/TemplateES_Main.o.d ${OBJECTDIR}/AtTowerSubHSM.o.d ${OBJECTDIR}/TapeSubState.o.d ${OBJECTDIR}/TraverseSubHSM.o.d ${OBJECTDIR}/TowerAlignSubHSM.o.d ${OBJECTDIR}/TowerTraverseSubHSM.o.d ${OBJECTDIR}/TowerShootSubHSM.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/robot.o ${OBJECTDIR}/Bot_EventCheckers.o ${OBJECTDIR}/RobotHSM.o ${OBJECTDIR}/TowardsTowerSubHSM.o ${OBJECTDIR}/robot_services.o ${OBJECTDIR}/_ext/1975241074/AD.o ${OBJECTDIR}/_ext/1975241074/BOARD.o ${OBJECTDIR}/_ext/1975241074/ES_CheckEvents.o ${OBJECTDIR}/_ext/1975241074/ES_Framework.o ${OBJECTDIR}/_ext/1975241074/ES_KeyboardInput.o ${OBJECTDIR}/_ext/1975241074/ES_PostList.o ${OBJECTDIR}/_ext/1975241074/ES_Queue.o ${OBJECTDIR}/_ext/1975241074/ES_TattleTale.o ${OBJECTDIR}/_ext/1975241074/ES_Timers.o ${OBJECTDIR}/_ext/1975241074/IO_Ports.o ${OBJECTDIR}/_ext/1975241074/LED.o ${OBJECTDIR}/_ext/1975241074/pwm.o ${OBJECTDIR}/_ext/1975241074/serial.o ${OBJECTDIR}/_ext/1975241074/timers.o ${OBJECTDIR}/TemplateES_Main.o ${OBJECTDIR}/AtTowerSubHSM.o ${OBJECTDIR}/TapeSubState.o ${OBJECTDIR}/TraverseSubHSM.o ${OBJECTDIR}/TowerAlignSubHSM.o ${OBJECTDIR}/TowerTraverseSubHSM.o ${OBJECTDIR}/TowerShootSubHSM.o ${OBJECTDIR}/robot_hal_pic32.o ${OBJECTDIR}/fixed_math.o ${OBJECTDIR}/beacon_goertzel.o ${OBJECTDIR}/robot_units.o ${OBJECTDIR}/loop_profiler.o ${OBJECTDIR}/hsm_engine.o ${OBJECTDIR}/queue_stats.o ${OBJECTDIR}/tape_filter.o ${OBJECTDIR}/telemetry.o ${OBJECTDIR}/event_trace.o ${OBJECTDIR}/motion_profile.o ${OBJECTDIR}/trackwire_cal.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/robot.o.d ${OBJECTDIR}/Bot_EventCheckers.o.d ${OBJECTDIR}/RobotHSM.o.d ${OBJECTDIR}/TowardsTowerSubHSM.o.d ${OBJECTDIR}/robot_services.o.d ${OBJECTDIR}/_ext/1975241074/AD.o.d ${OBJECTDIR}/_ext/1975241074/BOARD.o.d ${OBJECTDIR}/_ext/1975241074/ES_CheckEvents.o.d ${OBJECTDIR}/_ext/1975241074/ES_Framework.o.d ${OBJECTDIR}/_ext/1975241074/ES_KeyboardInput.o.d ${OBJECTDIR}/_ext/1975241074/ES_PostList.o.d ${OBJECTDIR}/_ext/1975241074/ES_Queue.o.d ${OBJECTDIR}/_ext/1975241074/ES_TattleTale.o.d ${OBJECTDIR}/_ext/1975241074/ES_Timers.o.d ${OBJECTDIR}/_ext/1975241074/IO_Ports.o.d ${OBJECTDIR}/_ext/1975241074/LED.o.d ${OBJECTDIR}/_ext/1975241074/pwm.o.d ${OBJECTDIR}/_ext/1975241074/serial.o.d ${OBJECTDIR}/_ext/1975241074/timers.o.d ${OBJECTDIR}/TemplateES_Main.o.d ${OBJECTDIR}/AtTowerSubHSM.o.d ${OBJECTDIR}/TapeSubState.o.d ${OBJECTDIR}/TraverseSubHSM.o.d ${OBJECTDIR}/TowerAlignSubHSM.o.d ${OBJECTDIR}/TowerTraverseSubHSM.o.d ${OBJECTDIR}/TowerShootSubHSM.o.d ${OBJECTDIR}/robot_hal_pic32.o.d ${OBJECTDIR}/fixed_math.o.d ${OBJECTDIR}/beacon_goertzel.o.d ${OBJECTDIR}/robot_units.o.d ${OBJECTDIR}/loop_profiler.o.d ${OBJECTDIR}/hsm_engine.o.d ${OBJECTDIR}/queue_stats.o.d ${OBJECTDIR}/tape_filter.o.d ${OBJECTDIR}/telemetry.o.d ${OBJECTDIR}/event_trace.o.d ${OBJECTDIR}/motion_profile.o.d ${OBJECTDIR}/trackwire_cal.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/robot.o ${OBJECTDIR}/Bot_EventCheckers.o ${OBJECTDIR}/RobotHSM.o ${OBJECTDIR}/TowardsTowerSubHSM.o ${OBJECTDIR}/robot_services.o ${OBJECTDIR}/_ext/1975241074/AD.o ${OBJECTDIR}/_ext/1975241074/BOARD.o ${OBJECTDIR}/_ext/1975241074/ES_CheckEvents.o ${OBJECTDIR}/_ext/1975241074/ES_Framework.o ${OBJECTDIR}/_ext/1975241074/ES_KeyboardInput.o ${OBJECTDIR}/_ext/1975241074/ES_PostList.o ${OBJECTDIR}/_ext/1975241074/ES_Queue.o ${OBJECTDIR}/_ext/1975241074/ES_TattleTale.o ${OBJECTDIR}/_ext/1975241074/ES_Timers.o ${OBJECTDIR}/_ext/1975241074/IO_Ports.o ${OBJECTDIR}/_ext/1975241074/LED.o ${OBJECTDIR}/_ext/1975241074/pwm.o ${OBJECTDIR}/_ext/1975241074/serial.o ${OBJECTDIR}/_ext/1975241074/timers.o ${OBJECTDIR}/TemplateES_Main.o ${OBJECTDIR}/AtTowerSubHSM.o ${OBJECTDIR}/TapeSubState.o ${OBJECTDIR}/TraverseSubHSM.o ${OBJECTDIR}/TowerAlignSubHSM.o ${OBJECTDIR}/TowerTraverseSubHSM.o ${OBJECTDIR}/TowerShootSubHSM.o
+OBJECTFILES=${OBJECTDIR}/robot.o ${OBJECTDIR}/Bot_EventCheckers.o ${OBJECTDIR}/RobotHSM.o ${OBJECTDIR}/TowardsTowerSubHSM.o ${OBJECTDIR}/robot_services.o ${OBJECTDIR}/_ext/1975241074/AD.o ${OBJECTDIR}/_ext/1975241074/BOARD.o ${OBJECTDIR}/_ext/1975241074/ES_CheckEvents.o ${OBJECTDIR}/_ext/1975241074/ES_Framework.o ${OBJECTDIR}/_ext/1975241074/ES_KeyboardInput.o ${OBJECTDIR}/_ext/1975241074/ES_PostList.o ${OBJECTDIR}/_ext/1975241074/ES_Queue.o ${OBJECTDIR}/_ext/1975241074/ES_TattleTale.o ${OBJECTDIR}/_ext/1975241074/ES_Timers.o ${OBJECTDIR}/_ext/1975241074/IO_Ports.o ${OBJECTDIR}/_ext/1975241074/LED.o ${OBJECTDIR}/_ext/1975241074/pwm.o ${OBJECTDIR}/_ext/1975241074/serial.o ${OBJECTDIR}/_ext/1975241074/timers.o ${OBJECTDIR}/TemplateES_Main.o ${OBJECTDIR}/AtTowerSubHSM.o ${OBJECTDIR}/TapeSubState.o ${OBJECTDIR}/TraverseSubHSM.o ${OBJECTDIR}/TowerAlignSubHSM.o ${OBJECTDIR}/TowerTraverseSubHSM.o ${OBJECTDIR}/TowerShootSubHSM.o ${OBJECTDIR}/robot_hal_pic32.o ${OBJECTDIR}/fixed_math.o ${OBJECTDIR}/beacon_goertzel.o ${OBJECTDIR}/robot_units.o ${OBJECTDIR}/loop_profiler.o ${OBJECTDIR}/hsm_engine.o ${OBJECTDIR}/queue_stats.o ${OBJECTDIR}/tape_filter.o ${OBJECTDIR}/telemetry.o ${OBJECTDIR}/event_trace.o ${OBJECTDIR}/motion_profile.o ${OBJECTDIR}/trackwire_cal.o
 
 # Source Files
-SOURCEFILES=robot.c Bot_EventCheckers.c RobotHSM.c TowardsTowerSubHSM.c robot_services.c C:/ECE118/src/AD.c C:/ECE118/src/BOARD.c C:/ECE118/src/ES_CheckEvents.c C:/ECE118/src/ES_Framework.c C:/ECE118/src/ES_KeyboardInput.c C:/ECE118/src/ES_PostList.c C:/ECE118/src/ES_Queue.c C:/ECE118/src/ES_TattleTale.c C:/ECE118/src/ES_Timers.c C:/ECE118/src/IO_Ports.c C:/ECE118/src/LED.c C:/ECE118/src/pwm.c C:/ECE118/src/serial.c C:/ECE118/src/timers.c TemplateES_Main.c AtTowerSubHSM.c TapeSubState.c TraverseSubHSM.c TowerAlignSubHSM.c TowerTraverseSubHSM.c TowerShootSubHSM.c
+SOURCEFILES=robot.c Bot_EventCheckers.c RobotHSM.c TowardsTowerSubHSM.c robot_services.c C:/ECE118/src/AD.c C:/ECE118/src/BOARD.c C:/ECE118/src/ES_CheckEvents.c C:/ECE118/src/ES_Framework.c C:/ECE118/src/ES_KeyboardInput.c C:/ECE118/src/ES_PostList.c C:/ECE118/src/ES_Queue.c C:/ECE118/src/ES_TattleTale.c C:/ECE118/src/ES_Timers.c C:/ECE118/src/IO_Ports.c C:/ECE118/src/LED.c C:/ECE118/src/pwm.c C:/ECE118/src/serial.c C:/ECE118/src/timers.c TemplateES_Main.c AtTowerSubHSM.c TapeSubState.c TraverseSubHSM.c TowerAlignSubHSM.c TowerTraverseSubHSM.c TowerShootSubHSM.c robot_hal_pic32.c fixed_math.c beacon_goertzel.c robot_units.c loop_profiler.c hsm_engine.c queue_stats.c tape_filter.c telemetry.c event_trace.c motion_profile.c trackwire_cal.c
 
 
 
@@ -153,6 +153,78 @@ ${OBJECTDIR}/robot_services.o: robot_services.c  .generated_files/flags/default/
 	@${RM} ${OBJECTDIR}/robot_services.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/robot_services.o.d" -o ${OBJECTDIR}/robot_services.o robot_services.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
 	
+${OBJECTDIR}/trackwire_cal.o: trackwire_cal.c  .generated_files/flags/default/387988b85b0638fa7f0be6cdf3265106d93f281b .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/trackwire_cal.o.d 
+	@${RM} ${OBJECTDIR}/trackwire_cal.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/trackwire_cal.o.d" -o ${OBJECTDIR}/trackwire_cal.o trackwire_cal.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/motion_profile.o: motion_profile.c  .generated_files/flags/default/49108fdc72c985cab82e52ac9ca4dbc42541573e .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/motion_profile.o.d 
+	@${RM} ${OBJECTDIR}/motion_profile.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/motion_profile.o.d" -o ${OBJECTDIR}/motion_profile.o motion_profile.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/event_trace.o: event_trace.c  .generated_files/flags/default/2f972b2c3245ae7b7a0a8ba15923723e79fd3317 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/event_trace.o.d 
+	@${RM} ${OBJECTDIR}/event_trace.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/event_trace.o.d" -o ${OBJECTDIR}/event_trace.o event_trace.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/telemetry.o: telemetry.c  .generated_files/flags/default/c547bdb4e5d9e64bfe73a6fd416c3bebfae79ff7 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/telemetry.o.d 
+	@${RM} ${OBJECTDIR}/telemetry.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/telemetry.o.d" -o ${OBJECTDIR}/telemetry.o telemetry.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/tape_filter.o: tape_filter.c  .generated_files/flags/default/f0e84506efe54d8245cf29fe5e51e06ba5621d76 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/tape_filter.o.d 
+	@${RM} ${OBJECTDIR}/tape_filter.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/tape_filter.o.d" -o ${OBJECTDIR}/tape_filter.o tape_filter.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/queue_stats.o: queue_stats.c  .generated_files/flags/default/db1ee31bbbf498f0edd33777024facc5be5f52ef .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/queue_stats.o.d 
+	@${RM} ${OBJECTDIR}/queue_stats.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/queue_stats.o.d" -o ${OBJECTDIR}/queue_stats.o queue_stats.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/hsm_engine.o: hsm_engine.c  .generated_files/flags/default/55ed62aad381b675f18bd20de83a97dfb3b27420 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/hsm_engine.o.d 
+	@${RM} ${OBJECTDIR}/hsm_engine.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/hsm_engine.o.d" -o ${OBJECTDIR}/hsm_engine.o hsm_engine.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/loop_profiler.o: loop_profiler.c  .generated_files/flags/default/1925545c031b5d759b63237a156b421193e4d3fd .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/loop_profiler.o.d 
+	@${RM} ${OBJECTDIR}/loop_profiler.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/loop_profiler.o.d" -o ${OBJECTDIR}/loop_profiler.o loop_profiler.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/robot_units.o: robot_units.c  .generated_files/flags/default/4dc14d0a94d84cf887f425c26ece043efa941c68 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/robot_units.o.d 
+	@${RM} ${OBJECTDIR}/robot_units.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/robot_units.o.d" -o ${OBJECTDIR}/robot_units.o robot_units.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/beacon_goertzel.o: beacon_goertzel.c  .generated_files/flags/default/09351261eeeff6ab9eae9bee33469c8ebcb9d421 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/beacon_goertzel.o.d 
+	@${RM} ${OBJECTDIR}/beacon_goertzel.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/beacon_goertzel.o.d" -o ${OBJECTDIR}/beacon_goertzel.o beacon_goertzel.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/fixed_math.o: fixed_math.c  .generated_files/flags/default/534d42c652ce1f750eb368de8b83db332dc6f448 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/fixed_math.o.d 
+	@${RM} ${OBJECTDIR}/fixed_math.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/fixed_math.o.d" -o ${OBJECTDIR}/fixed_math.o fixed_math.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/robot_hal_pic32.o: robot_hal_pic32.c  .generated_files/flags/default/1711f013918598a8ff6812c7fb55e0c9d942183a .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/robot_hal_pic32.o.d 
+	@${RM} ${OBJECTDIR}/robot_hal_pic32.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/robot_hal_pic32.o.d" -o ${OBJECTDIR}/robot_hal_pic32.o robot_hal_pic32.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
 ${OBJECTDIR}/_ext/1975241074/AD.o: C:/ECE118/src/AD.c  .generated_files/flags/default/8612ecf44b39b7ba1875a9183bc98789d5f2608b .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
 	@${MKDIR} "${OBJECTDIR}/_ext/1975241074" 
 	@${RM} ${OBJECTDIR}/_ext/1975241074/AD.o.d 
@@ -310,6 +382,78 @@ ${OBJECTDIR}/robot_services.o: robot_services.c  .generated_files/flags/default/
 	@${RM} ${OBJECTDIR}/robot_services.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/robot_services.o.d" -o ${OBJECTDIR}/robot_services.o robot_services.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
 	
+${OBJECTDIR}/trackwire_cal.o: trackwire_cal.c  .generated_files/flags/default/8d0bda553dd6ea54f46d827b7204ef1ff6df9032 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/trackwire_cal.o.d 
+	@${RM} ${OBJECTDIR}/trackwire_cal.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/trackwire_cal.o.d" -o ${OBJECTDIR}/trackwire_cal.o trackwire_cal.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/motion_profile.o: motion_profile.c  .generated_files/flags/default/3fc48336f61eb61e0080aacb145615f6d5466949 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/motion_profile.o.d 
+	@${RM} ${OBJECTDIR}/motion_profile.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/motion_profile.o.d" -o ${OBJECTDIR}/motion_profile.o motion_profile.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/event_trace.o: event_trace.c  .generated_files/flags/default/1a140b3a080d044665ad035226b8653bb970dc45 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/event_trace.o.d 
+	@${RM} ${OBJECTDIR}/event_trace.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/event_trace.o.d" -o ${OBJECTDIR}/event_trace.o event_trace.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/telemetry.o: telemetry.c  .generated_files/flags/default/e30f8bf30b62728a47875ab0b7193bdca6799d4f .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/telemetry.o.d 
+	@${RM} ${OBJECTDIR}/telemetry.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/telemetry.o.d" -o ${OBJECTDIR}/telemetry.o telemetry.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/tape_filter.o: tape_filter.c  .generated_files/flags/default/7f01bf5dc86a8b232df60d5e31c8564525a1570c .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/tape_filter.o.d 
+	@${RM} ${OBJECTDIR}/tape_filter.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/tape_filter.o.d" -o ${OBJECTDIR}/tape_filter.o tape_filter.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/queue_stats.o: queue_stats.c  .generated_files/flags/default/959193e727b02dc4e24f39bbf0e528adc5f12849 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/queue_stats.o.d 
+	@${RM} ${OBJECTDIR}/queue_stats.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/queue_stats.o.d" -o ${OBJECTDIR}/queue_stats.o queue_stats.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/hsm_engine.o: hsm_engine.c  .generated_files/flags/default/3774648221035836e43214ea3f2f40b42ee9e9b7 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/hsm_engine.o.d 
+	@${RM} ${OBJECTDIR}/hsm_engine.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/hsm_engine.o.d" -o ${OBJECTDIR}/hsm_engine.o hsm_engine.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/loop_profiler.o: loop_profiler.c  .generated_files/flags/default/7e53c3adb4f2f52d64e93ce04d599bc99a67dfed .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/loop_profiler.o.d 
+	@${RM} ${OBJECTDIR}/loop_profiler.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/loop_profiler.o.d" -o ${OBJECTDIR}/loop_profiler.o loop_profiler.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/robot_units.o: robot_units.c  .generated_files/flags/default/12f34d391f5d9c7dc37f2f9c842e6d7e379762cc .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/robot_units.o.d 
+	@${RM} ${OBJECTDIR}/robot_units.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/robot_units.o.d" -o ${OBJECTDIR}/robot_units.o robot_units.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/beacon_goertzel.o: beacon_goertzel.c  .generated_files/flags/default/3ad03cdf027877d18398a65a9fb860a8f3f1b946 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/beacon_goertzel.o.d 
+	@${RM} ${OBJECTDIR}/beacon_goertzel.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/beacon_goertzel.o.d" -o ${OBJECTDIR}/beacon_goertzel.o beacon_goertzel.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/fixed_math.o: fixed_math.c  .generated_files/flags/default/0e68c3b2971d5dca2efb3adb8c8585c2f6c23775 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/fixed_math.o.d 
+	@${RM} ${OBJECTDIR}/fixed_math.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/fixed_math.o.d" -o ${OBJECTDIR}/fixed_math.o fixed_math.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/robot_hal_pic32.o: robot_hal_pic32.c  .generated_files/flags/default/b4ebe2402996e1e907f6298af8827fbbd80dfb01 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/robot_hal_pic32.o.d 
+	@${RM} ${OBJECTDIR}/robot_hal_pic32.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -I"." -I"C:/ECE118/include" -MP -MMD -MF "${OBJECTDIR}/robot_hal_pic32.o.d" -o ${OBJECTDIR}/robot_hal_pic32.o robot_hal_pic32.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
 ${OBJECTDIR}/_ext/1975241074/AD.o: C:/ECE118/src/AD.c  .generated_files/flags/default/e57974dcc2db2aa35623870ed6983d1114da392d .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
 	@${MKDIR} "${OBJECTDIR}/_ext/1975241074" 
 	@${RM} ${OBJECTDIR}/_ext/1975241074/AD.o.d 
@@ -0,0 +1,158 @@
+/*
+ * File:   queue_stats.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include <stdio.h>
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "queue_stats.h"
+#include "robot_hal.h"
+
+/*** MACROS ***/
+#define QSTAT_STR(x) #x
+#define QSTAT_NAME(x) QSTAT_STR(x)
+
+/*** Module Variables ***/
+static QStat_t QStats[NUM_SERVICES];
+
+//same list as the queues in ES_Framework.c
+static const uint8_t QueueSizes[NUM_SERVICES] = {
+    SERV_0_QUEUE_SIZE,
+#if NUM_SERVICES > 1
+    SERV_1_QUEUE_SIZE,
+#endif
+#if NUM_SERVICES > 2
+    SERV_2_QUEUE_SIZE,
+#endif
+#if NUM_SERVICES > 3
+    SERV_3_QUEUE_SIZE,
+#endif
+#if NUM_SERVICES > 4
+    SERV_4_QUEUE_SIZE,
+#endif
+#if NUM_SERVICES > 5
+    SERV_5_QUEUE_SIZE,
+#endif
+#if NUM_SERVICES > 6
+    SERV_6_QUEUE_SIZE,
+#endif
+#if NUM_SERVICES > 7
+    SERV_7_QUEUE_SIZE,
+#endif
+};
+
+static const char * const QueueNames[NUM_SERVICES] = {
+    QSTAT_NAME(SERV_0_INIT),
+#if NUM_SERVICES > 1
+    QSTAT_NAME(SERV_1_INIT),
+#endif
+#if NUM_SERVICES > 2
+    QSTAT_NAME(SERV_2_INIT),
+#endif
+#if NUM_SERVICES > 3
+    QSTAT_NAME(SERV_3_INIT),
+#endif
+#if NUM_SERVICES > 4
+    QSTAT_NAME(SERV_4_INIT),
+#endif
+#if NUM_SERVICES > 5
+    QSTAT_NAME(SERV_5_INIT),
+#endif
+#if NUM_SERVICES > 6
+    QSTAT_NAME(SERV_6_INIT),
+#endif
+#if NUM_SERVICES > 7
+    QSTAT_NAME(SERV_7_INIT),
+#endif
+};
+
+/*** Public Functions ***/
+
+uint8_t QStat_Post(uint8_t Which, ES_Event ThisEvent) {
+    uint8_t returnVal = ES_PostToService(Which, ThisEvent);
+    QStat_t *q;
+    uint32_t ints;
+
+    if (Which >= NUM_SERVICES) {
+        return returnVal;
+    }
+    q = &QStats[Which];
+    ints = HAL_DisableInterrupts();
+    if (returnVal == TRUE) {
+        q->depth++;
+        q->posts++;
+        if (q->depth > q->high_water) {
+            q->high_water = q->depth;
+        }
+    } else {
+        q->lost_since_run++;
+        q->failed++;
+        q->last_failed = ThisEvent.EventType;
+    }
+    if ((q->depth + q->lost_since_run) > q->need) {
+        q->need = q->depth + q->lost_since_run;
+    }
+    HAL_RestoreInterrupts(ints);
+    return returnVal;
+}
+
+void QStat_Dequeued(uint8_t Which) {
+    uint32_t ints;
+
+    if (Which >= NUM_SERVICES) {
+        return;
+    }
+    ints = HAL_DisableInterrupts();
+    if (QStats[Which].depth) {
+        QStats[Which].depth--;
+    }
+    QStats[Which].lost_since_run = 0;
+    HAL_RestoreInterrupts(ints);
+}
+
+const QStat_t *QStat_Get(uint8_t Which) {
+    return (Which < NUM_SERVICES) ? &QStats[Which] : NULL;
+}
+
+uint16_t QStat_TotalFailed(void) {
+    uint16_t total = 0;
+    uint8_t i;
+
+    for (i = 0; i < NUM_SERVICES; i++) {
+        total += QStats[i].failed;
+    }
+    return total;
+}
+
+void QStat_Dump(void) {
+    uint8_t i;
+
+    printf("\r\nQUEUES, need is the size that would have held every burst\r\n");
+    printf("%-26s %5s %5s %5s %5s %8s %6s  %s\r\n", "service", "size", "depth", "high", "need", "posts",
+            "failed", "last lost");
+    for (i = 0; i < NUM_SERVICES; i++) {
+        QStat_t *q = &QStats[i];
+        printf("%-26s %5u %5u %5u %5u %8lu %6u  ", QueueNames[i], QueueSizes[i], q->depth, q->high_water,
+                q->need, (unsigned long) q->posts, q->failed);
+        if (q->failed) {
+            printf("%s\r\n", EventNames[q->last_failed]);
+        } else {
+            printf("-\r\n");
+        }
+    }
+}
+
+void QStat_Reset(void) {
+    uint8_t i;
+
+    for (i = 0; i < NUM_SERVICES; i++) {
+        QStats[i].high_water = QStats[i].depth;
+        QStats[i].need = QStats[i].depth;
+        QStats[i].lost_since_run = 0;
+        QStats[i].posts = 0;
+        QStats[i].failed = 0;
+        QStats[i].last_failed = ES_NO_EVENT;
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * File:   queue_stats.h
+ *
+ * Event queue accounting. The application Post functions (PostRobotHSM,
+ * PostVelocityService and the ES_INIT posts) go
+ * through QStat_Post instead of ES_PostToService, and each Run function calls
+ * QStat_Dequeued first, since ES_Run takes exactly one event off the queue per
+ * Run call. That gives, per service queue:
+ *
+ *   depth      - events waiting right now
+ *   high_water - deepest the queue has been
+ *   need       - deepest it would have been without failed posts, i.e. the
+ *                SERV_n_QUEUE_SIZE that would have held every burst so far
+ *   posts      - successful posts
+ *   failed     - posts ES_PostToService refused (queue full), the event is lost
+ *   last_failed - type of the last lost event
+ *
+ * Posts made inside the course library (ES_KeyboardInput) are not seen, so
+ * the keyboard queue always reads 0.
+ *
+ * The ES_Timers response functions (PostTimerEvent, PostVelocityService)
+ * post as well, and the course library's ES_Timers may run them from its
+ * timer interrupt, so the counters are updated with interrupts off
+ * (HAL_DisableInterrupts) and such a post cannot land between the read and
+ * the write of depth.
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef QUEUE_STATS_H
+#define	QUEUE_STATS_H
+
+#include "ES_Configure.h"
+#include "ES_Events.h"
+
+/*** TYPEDEFS ***/
+typedef struct {
+    uint8_t depth;
+    uint8_t high_water;
+    uint8_t need;
+    uint8_t lost_since_run; //failed posts since the last Run, adds to need
+    uint32_t posts;
+    uint16_t failed;
+    ES_EventTyp_t last_failed;
+} QStat_t;
+
+/*** Function Headers ***/
+uint8_t QStat_Post(uint8_t Which, ES_Event ThisEvent); //same return as ES_PostToService
+void QStat_Dequeued(uint8_t Which); //first thing in the Run function of service Which
+
+const QStat_t *QStat_Get(uint8_t Which); //NULL if Which is not a service
+uint16_t QStat_TotalFailed(void);
+void QStat_Dump(void); //prints the table with printf
+void QStat_Reset(void); //clears everything but the current depth
+
+#endif	/* QUEUE_STATS_H */
@@ -6,231 +6,516 @@
  */
 
 
-#include "xc.h"
 #include "robot.h"
-#include "IO_Ports.h"
-#include "pwm.h"
-#include "AD.h"
+#include "robot_hal.h"
+#include "fixed_math.h"
+#include "robot_units.h"
+#include "telemetry.h"
 #include "stdio.h"
 #include "ES_Framework.h"
 
 /*** Module Variables*/
-int32_t left_enc_count;
-int32_t right_enc_count;
+volatile int32_t left_enc_count; //only written by Robot_EncoderISR outside of critical sections
+volatile int32_t right_enc_count;
+static uint8_t left_enc_pins;
+static uint8_t right_enc_pins;
+
+//velocity loop state for one wheel, see Robot_VelocityUpdate
+typedef struct {
+    int32_t target; //ticks/s
+    int32_t velocity; //measured ticks/s
+    int32_t last_ticks;
+    int32_t integ; //integrator in duty/256
+} WheelLoop_t;
+
+static WheelLoop_t left_loop;
+static WheelLoop_t right_loop;
+
+//filtered battery reading in Q8 counts and the duty scale it gives, Q8
+static int32_t battery_filt;
+static int32_t battery_comp = 256;
+
+//odometry, heading kept as a 32 bit binary angle so the per tick increments
+//do not get rounded away, only the top 16 bits are used for the tables
+static int32_t odom_x; //Q16 mm
+static int32_t odom_y;
+static uint32_t odom_heading;
+static int32_t odom_left_ticks;
+static int32_t odom_right_ticks;
+
+static uint8_t solenoid_last_pulses;
+
+#if (UNITS_TICKS_PER_REV != ENC_TICKS_PER_REV) || (UNITS_WHEEL_DIAM_MM != WHEEL_DIAM_MM) \
+        || (UNITS_WHEEL_TRACK_MM != WHEEL_TRACK_MM)
+#error "the wheel geometry in robot_units.h has to match robot.h"
+#endif
+
+//bumper debouncing, the last BUMPER_DEBOUNCE_MS samples of all the bumpers,
+//one byte per 1 ms tick, so all six are filtered with a few byte ops
+#if (BUMPER_DEBOUNCE_MS < 3) || (BUMPER_DEBOUNCE_MS > 5)
+#error BUMPER_DEBOUNCE_MS has to be 3 to 5
+#endif
+static uint8_t bumper_hist[BUMPER_DEBOUNCE_MS];
+static uint8_t bumper_hist_idx;
+static volatile uint8_t bumper_state;
+
+//quadrature step indexed by (old AB << 2) | new AB. Counting up walks
+//00 -> 10 -> 11 -> 01 -> 00, no change or a double step (missed edge) is 0
+static const int8_t QuadStep[16] = {
+    0, -1, 1, 0,
+    1, 0, 0, -1,
+    -1, 0, 0, 1,
+    0, 1, -1, 0
+};
+
+//runs in interrupt context at HAL_TICK_HZ, a bumper bit goes high once it has
+//been high for every sample in the history and low once it has been low for all
+static void Robot_TickISR(void) {
+    uint8_t all = 0xFF;
+    uint8_t any = 0;
+    uint8_t i;
+
+    bumper_hist[bumper_hist_idx] = HAL_ReadBumpers();
+    if (++bumper_hist_idx >= BUMPER_DEBOUNCE_MS) {
+        bumper_hist_idx = 0;
+    }
+    for (i = 0; i < BUMPER_DEBOUNCE_MS; i++) {
+        all &= bumper_hist[i];
+        any |= bumper_hist[i];
+    }
+    bumper_state = (bumper_state & any) | all;
+}
 
+//runs in interrupt context, see HAL_EncoderStart
+static void Robot_EncoderISR(void) {
+    uint8_t pins;
 
-//directly based on delay macro from roach.c file given to us by instructors
+    pins = HAL_ReadEncoder(HAL_LEFT_MTR);
+    left_enc_count += QuadStep[(left_enc_pins << 2) | pins];
+    left_enc_pins = pins;
 
-int delay(int x) {
-    int wait;
-    for (int wait = 0; wait < x; wait++) {
-        asm("nop");
+    pins = HAL_ReadEncoder(HAL_RIGHT_MTR);
+    right_enc_count += QuadStep[(right_enc_pins << 2) | pins];
+    right_enc_pins = pins;
+}
+
+
+//runs the PI loop of one wheel and sets its duty, dt_ms is the time since the
+//last call (0 just applies the feedforward for a new setpoint)
+static void Robot_WheelLoopStep(WheelLoop_t *loop, HAL_Motor_t motor, int32_t ticks, uint16_t dt_ms) {
+    int32_t error;
+    int32_t duty;
+    int32_t integ;
+
+    if (dt_ms) {
+        loop->velocity = (ticks - loop->last_ticks) * 1000 / dt_ms;
+        loop->last_ticks = ticks;
+    }
+
+    //stopped wheels are left unpowered, like the old open loop 0 speed
+    if (loop->target == 0) {
+        loop->integ = 0;
+        HAL_SetMotor(motor, 0, 0);
+        return;
+    }
+
+    error = loop->target - loop->velocity;
+    integ = loop->integ;
+    if (dt_ms) {
+        integ += error * VEL_KI_Q8 * dt_ms / 1000;
+        if (integ > VEL_INTEG_LIMIT) {
+            integ = VEL_INTEG_LIMIT;
+        } else if (integ < -VEL_INTEG_LIMIT) {
+            integ = -VEL_INTEG_LIMIT;
+        }
+    }
+
+    duty = loop->target * VEL_MAX_DUTY / VEL_FREE_TICKS_S + (error * VEL_KP_Q8 + integ) / 256;
+    //the wheel speed a duty gives goes with the pack voltage, scaling the whole
+    //output keeps both the feedforward and the loop gain where they were tuned
+    duty = duty * battery_comp / 256;
+
+    //anti-windup: only keep the new integrator if it does not push further
+    //into saturation
+    if (duty > VEL_MAX_DUTY) {
+        duty = VEL_MAX_DUTY;
+        if (integ < loop->integ) {
+            loop->integ = integ;
+        }
+    } else if (duty < -VEL_MAX_DUTY) {
+        duty = -VEL_MAX_DUTY;
+        if (integ > loop->integ) {
+            loop->integ = integ;
+        }
+    } else {
+        loop->integ = integ;
+    }
+
+    if (duty >= 0) {
+        HAL_SetMotor(motor, 1, duty);
+    } else {
+        HAL_SetMotor(motor, 0, -duty);
     }
 }
 
+//first order filter of the battery reading, a sagging pack raises the duty
+//by BATTERY_NOMINAL / reading so a timed maneuver covers the same distance
+static void Robot_BatteryUpdate(void) {
+    int16_t block[HAL_ADC_BLOCK_LEN];
+    int32_t reading = 0;
+    uint32_t full = HAL_AdcScanCount() / HAL_ADC_BLOCK_LEN;
+    uint8_t i;
+
+    //mean of the last scan block, a single read before the first one is in
+    if (full && (ROBOT_ADC_READ == Robot_ReadAdcBlock(HAL_BATTERY_ADC, full - 1, block))) {
+        for (i = 0; i < HAL_ADC_BLOCK_LEN; i++) {
+            reading += block[i];
+        }
+        reading /= HAL_ADC_BLOCK_LEN;
+    } else {
+        reading = HAL_ReadAnalog(HAL_BATTERY_ADC);
+    }
+
+    battery_filt += ((reading << 8) - battery_filt) >> BATTERY_FILTER_SHIFT;
+    reading = battery_filt >> 8;
+    if (reading < BATTERY_MIN_COMP) {
+        //pack unplugged or nearly flat, more duty would not help
+        battery_comp = 256;
+    } else {
+        battery_comp = BATTERY_NOMINAL * 256 / reading;
+        if (battery_comp > BATTERY_COMP_MAX_Q8) {
+            battery_comp = BATTERY_COMP_MAX_Q8;
+        }
+    }
+}
+
+//busy wait, see HAL_Delay in robot_hal_pic32.c
+
+int delay(int x) {
+    HAL_Delay(x);
+    return x;
+}
+
 void Robot_Init(void) {
     //hw init
+    HAL_Init();
+    Telem_Init();
 
-    //tape pin setup
-    FRONT_LEFT_TAPE_TRIS = 1;
-    FRONT_RIGHT_TAPE_TRIS = 1;
-    FRONT_CENTER_TAPE_TRIS = 1;
-    BACK_LEFT_TAPE_TRIS = 1;
-    BACK_RIGHT_TAPE_TRIS = 1;
-    SIDE_FRONT_TAPE_TRIS = 1;
-    SIDE_BACK_TAPE_TRIS = 1;
-    //bumper pin setup
-    FRONT_LEFT_BUMPER_TRIS = 1;
-    FRONT_RIGHT_BUMPER_TRIS = 1;
-    BACK_LEFT_BUMPER_TRIS = 1;
-    BACK_RIGHT_BUMPER_TRIS = 1;
-    SIDE_LEFT_BUMPER_TRIS = 1;
-    SIDE_RIGHT_BUMPER_TRIS = 1;
-
-    //motor init
-    PWM_Init();
-    PWM_SetFrequency(1000);
-
-    PWM_AddPins(MTR_A_ENABLE | MTR_B_ENABLE);
-
-    //motor 1
-    //init dir & enc pins
-    MTR_A_IN1_TRIS = 0;
-    MTR_A_IN2_TRIS = 0;
-    MTR_A_ENCA_TRIS = 1;
-    MTR_A_ENCB_TRIS = 1;
-
-    //set initial direction forward
-    MTR_A_IN1_LAT = 1;
-    MTR_A_IN2_LAT = 0;
-
-    //motor2:
-    //init dir & enc pins
-    MTR_B_IN1_TRIS = 0;
-    MTR_B_IN2_TRIS = 0;
-    MTR_B_ENCA_TRIS = 1;
-    MTR_B_ENCB_TRIS = 1;
-
-    //set initial direction forward
-    MTR_B_IN1_LAT = 1;
-    MTR_B_IN2_LAT = 0;
-
-    //encoder setup
+    //encoder setup, decoding runs in the background from here on
     left_enc_count = 0;
     right_enc_count = 0;
-
-    //solenoid pin
-    SOLENOID_TRIS = 0;
-    SOLENOID_LAT = 0;
-
-    //track wire pin
-    TRACK_WIRE_TRISA = 0;
-    TRACK_WIRE_TRISB = 0;
-    AD_Init();
-    AD_AddPins(TRACK_WIRE_ADC);
-
-    //beacon pin
-    BEACON_TRISA = 0; //todo: maybe set A to true at start. Same applies to trackwire
-    BEACON_TRISB = 0;
-    BEACON_TRISC = 0;
-    AD_AddPins(BEACON_ADC);
+    left_enc_pins = HAL_ReadEncoder(HAL_LEFT_MTR);
+    right_enc_pins = HAL_ReadEncoder(HAL_RIGHT_MTR);
+    HAL_EncoderStart(Robot_EncoderISR);
+    HAL_AdcScanStart();
+
+    bumper_state = HAL_ReadBumpers();
+    for (bumper_hist_idx = 0; bumper_hist_idx < BUMPER_DEBOUNCE_MS; bumper_hist_idx++) {
+        bumper_hist[bumper_hist_idx] = bumper_state;
+    }
+    bumper_hist_idx = 0;
+    HAL_TickStart(Robot_TickISR);
+
+    left_loop.target = 0;
+    left_loop.velocity = 0;
+    left_loop.last_ticks = 0;
+    left_loop.integ = 0;
+    right_loop = left_loop;
+
+    battery_filt = (int32_t) HAL_ReadAnalog(HAL_BATTERY_ADC) << 8;
+    Robot_BatteryUpdate();
+
+    odom_x = 0;
+    odom_y = 0;
+    odom_heading = 0;
+    odom_left_ticks = 0;
+    odom_right_ticks = 0;
 }
 
 int16_t Robot_BatteryVoltage(void) {
-    return AD_ReadADPin(BAT_VOLTAGE);
+    return HAL_ReadAnalog(HAL_BATTERY_ADC);
+}
+
+int16_t Robot_BatteryFiltered(void) {
+    return battery_filt >> 8;
 }
 
 int16_t Robot_TrackWireDetector(void) {
-    return AD_ReadADPin(TRACK_WIRE_ADC);
+    return HAL_ReadAnalog(HAL_TRACK_WIRE_ADC);
 }
 
 int16_t Robot_BeaconDetector(void) {
-    return AD_ReadADPin(BEACON_ADC);
+    return HAL_ReadAnalog(HAL_BEACON_ADC);
+}
+
+void Robot_SelectBeacon(uint8_t index) {
+    HAL_SelectBeacon(index);
+}
+
+
+void Robot_SelectTrackWire(uint8_t index) {
+    HAL_SelectTrackWire(index);
+}
+
+uint32_t Robot_AdcScans(void) {
+    return HAL_AdcScanCount();
+}
+
+//a block's half of the ping-pong buffer is refilled from scan (block + 2) *
+//HAL_ADC_BLOCK_LEN on, so the copy is good if the count has not got there by
+//the time it is done
+uint8_t Robot_ReadAdcBlock(uint8_t channel, uint32_t block, int16_t *buf) {
+    const int16_t *data = HAL_AdcScanData(channel, block);
+    uint32_t scans = HAL_AdcScanCount();
+    uint8_t i;
+
+    if (scans < (block + 1) * HAL_ADC_BLOCK_LEN) {
+        return ROBOT_ADC_NOT_READY;
+    }
+    for (i = 0; i < HAL_ADC_BLOCK_LEN; i++) {
+        buf[i] = data[i];
+    }
+    if (HAL_AdcScanCount() > (block + 2) * HAL_ADC_BLOCK_LEN) {
+        return ROBOT_ADC_MISSED;
+    }
+    return ROBOT_ADC_READ;
 }
 
 uint16_t Robot_ReadTape(void) {
-    //return SIDE_FRONT_TAPE_BIT;
-    return ((SIDE_FRONT_TAPE_BIT << 6) | (SIDE_BACK_TAPE_BIT << 5) | (BACK_RIGHT_TAPE_BIT << 4) | (BACK_LEFT_TAPE_BIT << 3) | (FRONT_CENTER_TAPE_BIT << 2) | (FRONT_RIGHT_TAPE_BIT << 1) | FRONT_LEFT_TAPE_BIT);
+    return HAL_ReadTape();
 }
 
 unsigned char Robot_ReadBumpers(void) {
-    return ((SIDE_FRONT_BUMPER_BIT << 5) | (SIDE_BACK_BUMPER_BIT << 4) | (BACK_RIGHT_BUMPER_BIT << 3) | (BACK_LEFT_BUMPER_BIT << 2) | (FRONT_RIGHT_BUMPER_BIT << 1) | FRONT_LEFT_BUMPER_BIT);
+    return HAL_ReadBumpers();
+}
+
+uint8_t Robot_GetBumpers(void) {
+    return bumper_state;
+}
+
+//midpoint integration of the wheel travel since the last call. At 10 ms the
+//heading changes by a few degrees at most per step, so evaluating sin/cos half
+//way through the turn is accurate to well under the wheel slip
+
+void Robot_OdometryUpdate(void) {
+    int32_t left = left_enc_count;
+    int32_t right = right_enc_count;
+    int32_t dl = left - odom_left_ticks;
+    int32_t dr = right - odom_right_ticks;
+    int32_t dist; //Q16 mm travelled by the center
+    uint32_t dtheta;
+    uint16_t mid;
+
+    odom_left_ticks = left;
+    odom_right_ticks = right;
+
+    dist = (dl + dr) * ODOM_MM_PER_TICK_Q16 / 2;
+    dtheta = (uint32_t) ((dr - dl) * ODOM_TURN_PER_TICK_Q32);
+    mid = (odom_heading + (uint32_t) ((int32_t) dtheta / 2)) >> 16;
+
+    odom_x += (int32_t) (((int64_t) dist * Fix_CosQ16(mid)) >> 16);
+    odom_y += (int32_t) (((int64_t) dist * Fix_SinQ16(mid)) >> 16);
+    odom_heading += dtheta;
+}
+
+Robot_Pose_t Robot_GetPose(void) {
+    Robot_Pose_t pose;
+
+    pose.x = odom_x;
+    pose.y = odom_y;
+    pose.heading = odom_heading >> 16;
+    return pose;
+}
+
+void Robot_SetPose(Robot_Pose_t pose) {
+    odom_x = pose.x;
+    odom_y = pose.y;
+    odom_heading = (uint32_t) pose.heading << 16;
 }
 
 //Set left motor speed and direction
-//input: -100 to 100
+//input: -100 to 100, scaled to a wheel velocity held by the velocity loop
 
 unsigned char Robot_LeftMtrSpeed(int mtr_speed) {
     //check input against speed bounds
     if ((mtr_speed < MIN_MTR_SPEED) || (mtr_speed > MAX_MTR_SPEED)) {
+#ifdef USE_TELEMETRY
+        Telem_Frame(TELEM_SRC_Robot, TELEM_MTR_RANGE, mtr_speed, HAL_LEFT_MTR);
+#else
         printf("Robot_SetLeftMtrSpeed ERROR: mtr_speed of %d exceeds bounds\n", mtr_speed);
+#endif
         return -1;
     }
 
-
-    //set direction
-    if (mtr_speed > 0) {
-        MTR_A_IN1_LAT = 1;
-        MTR_A_IN2_LAT = 0;
-    } else {
-        mtr_speed = -mtr_speed; //get positive value for mtrspeed
-        MTR_A_IN1_LAT = 0;
-        MTR_A_IN2_LAT = 1;
-    }
-    mtr_speed = mtr_speed * 95 / 100; //try to compensate for stronger left motor by reducing power by 5%
-
-    //set PWM based on speed
-    PWM_SetDutyCycle(MTR_A_ENABLE, mtr_speed * 10);
-
+    Robot_SetWheelVelocity(mtr_speed * ROBOT_MAX_WHEEL_TICKS_S / MAX_MTR_SPEED, right_loop.target);
     return 1;
 }
 
 //Set right motor speed and direction
-//input: -100 to 100
+//input: -100 to 100, scaled to a wheel velocity held by the velocity loop
 
 unsigned char Robot_RightMtrSpeed(int mtr_speed) {
     //check input against speed bounds
     if ((mtr_speed < MIN_MTR_SPEED) || (mtr_speed > MAX_MTR_SPEED)) {
+#ifdef USE_TELEMETRY
+        Telem_Frame(TELEM_SRC_Robot, TELEM_MTR_RANGE, mtr_speed, HAL_RIGHT_MTR);
+#else
         printf("Robot_SetRightMtrSpeed ERROR: mtr_speed of %d exceeds bounds\n", mtr_speed);
+#endif
         return -1;
     }
 
-    //set direction
+    Robot_SetWheelVelocity(left_loop.target, mtr_speed * ROBOT_MAX_WHEEL_TICKS_S / MAX_MTR_SPEED);
+    return 1;
+}
+
+//Set both wheel velocity setpoints in encoder ticks/s. The feedforward duty is
+//applied right away, the PI correction follows on the next VelocityService tick
 
-    if (mtr_speed > 0) {
-        MTR_B_IN1_LAT = 1;
-        MTR_B_IN2_LAT = 0;
-    } else {
-        mtr_speed = -mtr_speed; //get positive value for mtrspeed
-        MTR_B_IN1_LAT = 0;
-        MTR_B_IN2_LAT = 1;
+void Robot_SetWheelVelocity(int32_t left_ticks_s, int32_t right_ticks_s) {
+    //restart the integrator on a direction change, the old correction is
+    //for the wrong direction
+    if ((left_ticks_s ^ left_loop.target) < 0) {
+        left_loop.integ = 0;
     }
+    if ((right_ticks_s ^ right_loop.target) < 0) {
+        right_loop.integ = 0;
+    }
+    left_loop.target = left_ticks_s;
+    right_loop.target = right_ticks_s;
+    Robot_WheelLoopStep(&left_loop, HAL_LEFT_MTR, left_enc_count, 0);
+    Robot_WheelLoopStep(&right_loop, HAL_RIGHT_MTR, right_enc_count, 0);
+}
 
+//called by VelocityService every VELOCITY_TIMER_TICKS ms
 
-    //set PWM based on speed
-    PWM_SetDutyCycle(MTR_B_ENABLE, mtr_speed * 10);
+void Robot_VelocityUpdate(uint16_t dt_ms) {
+    if (dt_ms == 0) {
+        return;
+    }
+    Robot_BatteryUpdate();
+    Robot_WheelLoopStep(&left_loop, HAL_LEFT_MTR, left_enc_count, dt_ms);
+    Robot_WheelLoopStep(&right_loop, HAL_RIGHT_MTR, right_enc_count, dt_ms);
+}
 
-    return 1;
+int32_t Robot_GetLeftWheelVelocity(void) {
+    return left_loop.velocity;
 }
 
-int Robot_IncrementLeftEnc(void) {
+int32_t Robot_GetRightWheelVelocity(void) {
+    return right_loop.velocity;
+}
 
-    left_enc_count++;
+uint8_t Robot_ReadLeftEncPins(void) {
+    return HAL_ReadEncoder(HAL_LEFT_MTR);
+}
+
+uint8_t Robot_ReadRightEncPins(void) {
+    return HAL_ReadEncoder(HAL_RIGHT_MTR);
+}
 
+int32_t Robot_GetLeftEncTicks(void) {
+    return left_enc_count;
+}
+
+int32_t Robot_GetRightEncTicks(void) {
+    return right_enc_count;
+}
+
+//manual count adjustments, masked so they do not race the encoder interrupt
+
+int Robot_IncrementLeftEnc(void) {
+    HAL_EncoderIntDisable();
+    left_enc_count++;
+    HAL_EncoderIntEnable();
     return 1;
 }
 
 int Robot_DecrementLeftEnc(void) {
+    HAL_EncoderIntDisable();
     left_enc_count--;
-
+    HAL_EncoderIntEnable();
     return 1;
 }
 
 int Robot_IncrementRightEnc(void) {
-
+    HAL_EncoderIntDisable();
     right_enc_count++;
-
+    HAL_EncoderIntEnable();
+    return 1;
 }
 
 int Robot_DecrementRightEnc(void) {
-
+    HAL_EncoderIntDisable();
     right_enc_count--;
-
+    HAL_EncoderIntEnable();
+    return 1;
 }
 
 int Robot_SetLeftEncTick(int32_t ticks) {
+    HAL_EncoderIntDisable();
     left_enc_count = ticks;
+    HAL_EncoderIntEnable();
+    left_loop.last_ticks = ticks; //rebase so the velocity and odometry see no jump
+    odom_left_ticks = ticks;
     return 1;
 }
 
 int Robot_SetRightEncTick(int32_t ticks) {
+    HAL_EncoderIntDisable();
     right_enc_count = ticks;
+    HAL_EncoderIntEnable();
+    right_loop.last_ticks = ticks; //rebase so the velocity and odometry see no jump
+    odom_right_ticks = ticks;
     return 1;
 }
 
-int16_t Robot_GetLeftEnc_Degrees(void) {
-    return (int16_t) (left_enc_count * 360 / ENC_TICKS_PER_REV);
+//conversions are fixed point, see robot_units.h
+
+int32_t Robot_GetLeftEnc_Degrees(void) {
+    return Units_TicksToDeg(left_enc_count);
+}
+
+int32_t Robot_GetLeftEnc_MM(void) {
+    return Units_TicksToMM(left_enc_count);
+}
+
+int32_t Robot_GetRightEnc_Degrees(void) {
+    return Units_TicksToDeg(right_enc_count);
 }
 
-int16_t Robot_GetLeftEnc_MM(void) {
-    return (int16_t) (left_enc_count * 2 * 3.14 * WHEEL_DIAM_MM / ENC_TICKS_PER_REV);
+int32_t Robot_GetRightEnc_MM(void) {
+    return Units_TicksToMM(right_enc_count);
 }
 
-int16_t Robot_GetRightEnc_Degrees(void) {
-    return (int16_t) (right_enc_count * 360 / ENC_TICKS_PER_REV);
+int32_t Robot_GetLeftMtrDist(void) {
+    return Units_TicksTo100thIn(left_enc_count);
 }
 
-int16_t Robot_GetRightEnc_MM(void) {
-    return (int16_t) (right_enc_count * 2 * 3.14 * WHEEL_DIAM_MM / ENC_TICKS_PER_REV);
+int32_t Robot_GetRightMtrDist(void) {
+    return Units_TicksTo100thIn(right_enc_count);
 }
 
 unsigned char Robot_SolenoidPopBall(void) {
-    SOLENOID_LAT = 1;
-    delay(500000);
-    SOLENOID_LAT = 0;
+    return Robot_SolenoidFire(1, SOLENOID_PULSE_MS, 0);
+}
+
+//the pulses are timed in the background (HAL_SolenoidPulseTrain), a train
+//already running is not cut short
 
+unsigned char Robot_SolenoidFire(uint8_t pulses, uint16_t on_ms, uint16_t off_ms) {
+    if (HAL_SolenoidBusy() || (0 == pulses)) {
+        return 0;
+    }
+    solenoid_last_pulses = pulses;
+    HAL_SolenoidPulseTrain(pulses, on_ms, off_ms);
     return 1;
 }
 
+uint8_t Robot_SolenoidBusy(void) {
+    return HAL_SolenoidBusy();
+}
 
-
+uint8_t Robot_SolenoidLastPulses(void) {
+    return solenoid_last_pulses;
+}
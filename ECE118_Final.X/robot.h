@@ -4,16 +4,21 @@
  *
  * Created on November 16, 2021, 5:51 PM
  */
+#ifndef ROBOT_HOST //pin defines below only exist on the PIC32, host builds go through robot_hal.h
 #include "xc.h"
 #include "IO_Ports.h"
-#include "ES_Configure.h"
 #include "ad.h"
 #include "pwm.h"
+#endif
+#include "BOARD.h"
+#include "ES_Configure.h"
 #include "ES_Events.h"
+#include "robot_units.h"
 #ifndef ROBOT_H
 #define	ROBOT_H
 
 /*** MACROS ***/
+#ifndef ROBOT_HOST
 
 //PIN DEFINES - TAPE
 #define FRONT_LEFT_TAPE_TRIS PORTX03_TRIS
@@ -93,6 +98,7 @@
 
 //PIN DEFINES - TRACK WIRE 
 #define TRACK_WIRE_ADC AD_PORTW3
+#define TRACK_WIRE_AN 3 //ANx (RBx) behind AD_PORTW3, Uno32 A6
 #define TRACK_WIRE_TRISA PORTW04_TRIS
 #define TRACK_WIRE_TRISB PORTW05_TRIS
 #define TRACK_WIRE_LATA PORTW04_LAT
@@ -104,6 +110,7 @@
 
 //PIN DEFINES - BEACON  
 #define BEACON_ADC AD_PORTV4
+#define BEACON_AN 4 //ANx (RBx) behind AD_PORTV4, Uno32 A1
 #define BEACON_TRISA PORTV05_TRIS
 #define BEACON_TRISB PORTV06_TRIS
 #define BEACON_TRISC PORTV07_TRIS
@@ -111,14 +118,23 @@
 #define BEACON_LATB PORTV06_LAT
 #define BEACON_LATC PORTV07_LAT
 
+//PIN DEFINES - BATTERY
+#define BAT_VOLTAGE_AN 0 //ANx (RBx) behind BAT_VOLTAGE, the I/O stack's battery divider
+#endif /* ROBOT_HOST */
+
 
 //BEACON MASK
 //#define UPPER_BEACON_BOUND 630
 //#define LOWER_BEACON_BOUND 600
-#define LEFT_BEACON_MASK 0x1 //need to add corresponding offset amount macros
+#define LEFT_BEACON_MASK 0x1
 #define FRONT_BEACON_MASK 0x2
 #define RIGHT_BEACON_MASK 0x4
 
+//direction each detector looks, degrees counterclockwise from forward
+#define LEFT_BEACON_OFFSET_DEG 90
+#define FRONT_BEACON_OFFSET_DEG 0
+#define RIGHT_BEACON_OFFSET_DEG (-90)
+
 //TAPE MASK
 #define FRONT_LEFT_TAPE_MASK  0x01
 #define FRONT_RIGHT_TAPE_MASK 0x02
@@ -146,19 +162,71 @@
 #define ENC_TICKS_PER_REV 1632
 #define WHEEL_DIAM_MM 62 
 #define WHEEL_DIAM_1_100_IN 244 //diam in 1/100 inch units (diam in mm = 62)
+#define SOLENOID_PULSE_MS 50 //same as the old delay(500000) pop
+#define BUMPER_DEBOUNCE_MS 4 //3 to 5, a bumper has to read the same for this long to change
+
+//VELOCITY LOOP (encoder ticks/s, duty is 0-1000)
+#define ROBOT_MAX_WHEEL_TICKS_S 3300 //setpoint for a speed of 100, kept under the free running speed so the loop has headroom
+#define VEL_FREE_TICKS_S 4000 //free running wheel speed at full duty, used for the feedforward
+#define VEL_MAX_DUTY 1000
+#define VEL_KP_Q8 64 //0.25 duty per tick/s
+#define VEL_KI_Q8 640 //2.5 duty per tick/s per second
+#define VEL_INTEG_LIMIT (300 * 256) //integrator clamp, +-300 duty
+
+//BATTERY COMPENSATION (ADC counts of Robot_BatteryVoltage)
+#define BATTERY_NOMINAL 700 //fresh pack under load, the gains above were tuned at this
+#define BATTERY_FILTER_SHIFT 4 //first order filter, ~16 VelocityService ticks time constant
+#define BATTERY_MIN_COMP 350 //lowest reading that is compensated, under it the motors run on the nominal duty
+#define BATTERY_COMP_MAX_Q8 384 //duty is raised by 1.5x at most
+
+//MOTION PROFILES (encoder ticks, see motion_profile.h)
+#define MOTION_ACCEL_TICKS_S2 12000 //0 to ROBOT_MAX_WHEEL_TICKS_S in ~0.3 s
+#define MOTION_JERK_TICKS_S3 150000 //acceleration ramps in and out over 80 ms
+#define MOTION_MIN_TICKS_S 150 //creep speed for the last ticks of a move
+
+//ODOMETRY
+#define WHEEL_TRACK_MM 230 //distance between the wheel contact patches
+#define ODOM_MM_PER_TICK_Q16 ((int32_t) (UNITS_PI * WHEEL_DIAM_MM * 65536 / ENC_TICKS_PER_REV + 0.5)) //mm of one tick
+//heading change of one tick of wheel difference, 2^32 = one turn: the wheel
+//moves pi * WHEEL_DIAM_MM / ENC_TICKS_PER_REV, over 2 pi * WHEEL_TRACK_MM
+#define ODOM_TURN_PER_TICK_Q32 ((int32_t) ((((int64_t) WHEEL_DIAM_MM << 32) + ENC_TICKS_PER_REV * WHEEL_TRACK_MM) \
+        / (2 * ENC_TICKS_PER_REV * WHEEL_TRACK_MM)))
+
+//x and y are Q16 mm from the pose at Robot_Init (or the last Robot_SetPose),
+//x starts out pointing forward and y to the left. heading is a binary angle
+//(65536 = 360 deg) counterclockwise from the x axis, see fixed_math.h
+typedef struct {
+    int32_t x;
+    int32_t y;
+    uint16_t heading;
+} Robot_Pose_t;
 
 
 
 /** Function Headers ***/
 void Robot_Init(void);
 int delay(int x);
-unsigned char Robot_ReadBumpers(void);
+unsigned char Robot_ReadBumpers(void); //raw pins
+uint8_t Robot_GetBumpers(void); //debounced at HAL_TICK_HZ, CheckBumper posts its changes
 uint16_t Robot_ReadTape(void);
-unsigned char Robot_SolenoidPopBall(void); //activates solenoid for short amount of time
+unsigned char Robot_SolenoidPopBall(void); //one SOLENOID_PULSE_MS pulse, returns right away
+unsigned char Robot_SolenoidFire(uint8_t pulses, uint16_t on_ms, uint16_t off_ms); //pulse train, CheckSolenoid posts BALL_FIRED at the end
+uint8_t Robot_SolenoidBusy(void);
+uint8_t Robot_SolenoidLastPulses(void); //length of the last train started
 int16_t Robot_BatteryVoltage(void);
+int16_t Robot_BatteryFiltered(void); //filtered with the velocity loop, this is what the duty is scaled by
 int16_t Robot_TrackWireDetector(void);
 int16_t Robot_BeaconDetector(void);
+void Robot_SelectBeacon(uint8_t index); //0 = left, 1 = front, 2 = right
+void Robot_SelectTrackWire(uint8_t index);
 
+//Analog scan blocks, the beacon, track wire and battery channels sampled in
+//the background (HAL_AdcScanStart in robot_hal.h). channel is a HAL_Analog_t
+#define ROBOT_ADC_NOT_READY 0 //Robot_ReadAdcBlock results
+#define ROBOT_ADC_READ 1
+#define ROBOT_ADC_MISSED 2 //already overwritten, the caller fell more than a block behind
+uint32_t Robot_AdcScans(void); //scans so far, block n starts at scan n * HAL_ADC_BLOCK_LEN
+uint8_t Robot_ReadAdcBlock(uint8_t channel, uint32_t block, int16_t *buf); //copies HAL_ADC_BLOCK_LEN samples
 
 
 //Motors
@@ -166,11 +234,26 @@ unsigned char Robot_LeftMtrSpeed(int mtr_speed);
 unsigned char Robot_RightMtrSpeed(int mtr_speed);
 int Robot_GetLeftMtrRevs(void); //returns revolutions traveled in x units
 int Robot_GetRightMtrRevs(void); //returns revolutions traveled in x units
-int Robot_GetLeftMtrDist(void); //returns distance traveled in 1/100 inches
-int Robot_GetRightMtrDist(void); //returns distance traveled in 1/100 inches
-
-
-//Encoders
+int32_t Robot_GetLeftMtrDist(void); //returns distance traveled in 1/100 inches
+int32_t Robot_GetRightMtrDist(void); //returns distance traveled in 1/100 inches
+
+//Closed loop wheel velocity (the MtrSpeed functions above also go through this)
+void Robot_SetWheelVelocity(int32_t left_ticks_s, int32_t right_ticks_s);
+void Robot_VelocityUpdate(uint16_t dt_ms); //runs the PI loops, called from VelocityService
+int32_t Robot_GetLeftWheelVelocity(void); //measured ticks/s
+int32_t Robot_GetRightWheelVelocity(void);
+
+//Dead reckoning pose from the encoders, updated with the velocity loop
+void Robot_OdometryUpdate(void); //integrates the ticks since the last call, called from VelocityService
+Robot_Pose_t Robot_GetPose(void);
+void Robot_SetPose(Robot_Pose_t pose);
+
+
+//Encoders (counted in the background by the encoder interrupt, see robot.c)
+int32_t Robot_GetLeftEncTicks(void);
+int32_t Robot_GetRightEncTicks(void);
+uint8_t Robot_ReadLeftEncPins(void); //returns (A << 1) | B
+uint8_t Robot_ReadRightEncPins(void); //returns (A << 1) | B
 int Robot_IncrementLeftEnc(void);
 int Robot_DecrementLeftEnc(void);
 int Robot_SetLeftEncTick(int32_t ticks);
@@ -178,11 +261,11 @@ int Robot_IncrementRightEnc(void);
 int Robot_DecrementRightEnc(void);
 int Robot_SetRightEncTick(int32_t ticks);
 
-int16_t Robot_GetLeftEnc_Degrees(void); //returns encoder count in degrees rotated
-int16_t Robot_GetLeftEnc_MM(void); //returns encoder count in distance traversed (in mm))
+int32_t Robot_GetLeftEnc_Degrees(void); //returns encoder count in degrees rotated
+int32_t Robot_GetLeftEnc_MM(void); //returns encoder count in distance traversed (in mm))
 
-int16_t Robot_GetRightEnc_Degrees(void); //returns encoder count in degrees rotated
-int16_t Robot_GetRightEnc_MM(void); //returns encoder count in distance traversed (in mm))
+int32_t Robot_GetRightEnc_Degrees(void); //returns encoder count in degrees rotated
+int32_t Robot_GetRightEnc_MM(void); //returns encoder count in distance traversed (in mm))
 
 #endif	/* ROBOT_H */
 
@@ -0,0 +1,135 @@
+/*
+ * File:   robot_hal.h
+ *
+ * Hardware abstraction layer underneath the Robot_* API in robot.c. Everything
+ * that touches a port bit, PWM channel or ADC pin goes through these functions
+ * so the rest of the ES_Framework application can be built for either target:
+ *
+ *   robot_hal_pic32.c - the real PIC32MX320 (IO_Ports, pwm, AD libraries)
+ *   robot_hal_posix.c - host build (ROBOT_HOST defined), virtual pins and a
+ *                       virtual microsecond clock driven by the event loop
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef ROBOT_HAL_H
+#define	ROBOT_HAL_H
+
+#include <stdint.h>
+
+/*** MACROS ***/
+#define HAL_MAX_DUTY 1000 //full scale PWM duty (matches pwm.c MAX_PWM)
+
+#define HAL_ENC_SAMPLE_HZ 20000 //encoder sampling rate, several times the edge rate at full speed
+
+#define HAL_ADC_SCAN_HZ 10000 //every analog channel is sampled at this rate, every 2nd encoder interrupt
+#define HAL_ADC_BLOCK_LEN 25 //samples of each channel per scan block, 2.5 ms
+#define HAL_BEACON_SAMPLE_HZ HAL_ADC_SCAN_HZ
+#define HAL_BEACON_TONE_HZ 2000 //IR modulation of the arena beacons
+
+#define HAL_TICK_HZ 1000 //HAL_TickStart callback rate, HAL_ENC_SAMPLE_HZ has to be a multiple
+
+#ifndef ROBOT_HOST
+#define HAL_CYCLES_PER_US 40 //core timer, SYSCLK / 2
+#else
+#define HAL_CYCLES_PER_US 1000 //host monotonic clock in ns
+#endif
+
+#define HAL_NUM_BEACONS 3 //left, front, right (see *_BEACON_MASK in robot.h)
+#define HAL_NUM_TRACK_WIRES 2
+
+/*** TYPEDEFS ***/
+typedef enum {
+    HAL_LEFT_MTR, //h-bridge channel A
+    HAL_RIGHT_MTR, //h-bridge channel B
+    HAL_NUM_MTRS,
+} HAL_Motor_t;
+
+typedef enum {
+    HAL_BATTERY_ADC,
+    HAL_BEACON_ADC, //reads whichever detector HAL_SelectBeacon picked
+    HAL_TRACK_WIRE_ADC, //reads whichever detector HAL_SelectTrackWire picked
+    HAL_NUM_ADC,
+} HAL_Analog_t;
+
+/*** Function Headers ***/
+void HAL_Init(void);
+void HAL_Delay(int loops); //busy wait, same units as the old nop loop in delay()
+uint32_t HAL_ReadCycles(void); //free running, wraps, HAL_CYCLES_PER_US per us of real time
+
+//All interrupts off around a few instructions that share data with code that
+//may run in an interrupt, the value goes back to HAL_RestoreInterrupts so a
+//nested pair leaves them off. Nothing to mask on the host.
+uint32_t HAL_DisableInterrupts(void);
+void HAL_RestoreInterrupts(uint32_t status);
+
+//Digital inputs, already packed into the *_TAPE_MASK / *_BMP_MASK layout
+uint16_t HAL_ReadTape(void);
+uint8_t HAL_ReadBumpers(void);
+uint8_t HAL_ReadEncoder(HAL_Motor_t motor); //returns (A << 1) | B
+
+//Outputs
+void HAL_SetMotor(HAL_Motor_t motor, uint8_t forward, uint16_t duty); //duty 0 to HAL_MAX_DUTY
+void HAL_SetSolenoid(uint8_t on);
+void HAL_SolenoidPulseTrain(uint8_t pulses, uint16_t on_ms, uint16_t off_ms); //timed from the encoder interrupt
+uint8_t HAL_SolenoidBusy(void); //TRUE until the last pulse of the train has ended
+void HAL_SelectBeacon(uint8_t index);
+void HAL_SelectTrackWire(uint8_t index);
+
+//Analog inputs
+uint16_t HAL_ReadAnalog(HAL_Analog_t channel);
+
+//Encoder interrupt. isr runs in interrupt context whenever the encoder pins may
+//have changed: Timer4 sampling at HAL_ENC_SAMPLE_HZ on the PIC32, every pin
+//change in the host build. Disable/Enable bracket main context writes.
+typedef void (*HAL_EncoderISRFunc)(void);
+
+void HAL_EncoderStart(HAL_EncoderISRFunc isr);
+void HAL_EncoderIntDisable(void);
+void HAL_EncoderIntEnable(void);
+
+//1 ms tick in interrupt context, rides on the encoder interrupt on the PIC32
+//(HAL_EncoderStart must have been called), every ms of virtual time on the host
+typedef void (*HAL_TickFunc)(void);
+
+void HAL_TickStart(HAL_TickFunc tick);
+
+//Telemetry UART, sends whatever Telem_NextByte (telemetry.h) hands out in the
+//background: UART2 TX interrupt on the PIC32, the ROBOT_HOST_TELEM file on the host
+void HAL_TelemetryStart(void);
+void HAL_TelemetryKick(void); //after a frame went into the ring
+
+//Analog scan, every HAL_Analog_t channel read together at exactly
+//HAL_ADC_SCAN_HZ into ping-pong blocks of HAL_ADC_BLOCK_LEN samples per
+//channel (rides on the encoder interrupt, so HAL_EncoderStart must have been
+//called). Scan n of the run is sample n % HAL_ADC_BLOCK_LEN of block
+//n / HAL_ADC_BLOCK_LEN. A full block stays put while the next one fills, so
+//it can be read until that one is full too (see Robot_ReadAdcBlock).
+void HAL_AdcScanStart(void);
+uint32_t HAL_AdcScanCount(void); //scans taken so far
+const int16_t *HAL_AdcScanData(HAL_Analog_t channel, uint32_t block); //where block is, or will be, kept
+
+
+#ifdef ROBOT_HOST
+/*** Host only: virtual clock and pin injection for simulators and tests ***/
+typedef void (*HAL_HostStepFunc)(uint32_t elapsed_us);
+
+uint64_t HAL_HostGetMicros(void);
+void HAL_HostAdvance(uint32_t elapsed_us); //moves the virtual clock and steps the plant
+void HAL_HostSetStepFunc(HAL_HostStepFunc step); //plant model called on every advance
+
+void HAL_HostSetTape(uint16_t tape);
+void HAL_HostSetBumpers(uint8_t bumpers);
+void HAL_HostSetEncoder(HAL_Motor_t motor, uint8_t phase); //runs the encoder isr on a change
+void HAL_HostSetBattery(uint16_t reading);
+void HAL_HostSetBeacon(uint8_t index, uint16_t reading);
+void HAL_HostSetBeaconTone(uint8_t index, uint16_t amplitude); //HAL_BEACON_TONE_HZ on top of the reading, captures only
+void HAL_HostSetTrackWire(uint8_t index, uint16_t reading);
+
+int16_t HAL_HostGetMotor(HAL_Motor_t motor); //signed duty, -HAL_MAX_DUTY to HAL_MAX_DUTY
+uint8_t HAL_HostGetSolenoid(void);
+uint8_t HAL_HostGetBeaconSelect(void);
+uint8_t HAL_HostGetTrackWireSelect(void);
+#endif
+
+#endif	/* ROBOT_HAL_H */
@@ -0,0 +1,398 @@
+/*
+ * File:   robot_hal_pic32.c
+ *
+ * PIC32MX320 backend for robot_hal.h. Pin assignments live in robot.h.
+ *
+ * Created on October 17, 2026
+ */
+
+
+#include "xc.h"
+#include <sys/attribs.h>
+#include "robot.h"
+#include "robot_hal.h"
+#include "telemetry.h"
+#include "IO_Ports.h"
+#include "pwm.h"
+
+static HAL_EncoderISRFunc encoder_isr;
+static HAL_TickFunc tick_func;
+static uint8_t tick_div;
+
+#if (HAL_ENC_SAMPLE_HZ % HAL_ADC_SCAN_HZ) != 0
+#error "the ADC bursts are started from Timer4, HAL_ADC_SCAN_HZ has to divide HAL_ENC_SAMPLE_HZ"
+#endif
+
+//ADC1 timing with the 40 MHz PBCLK: TAD = 2 * (ADCS + 1) / PBCLK = 400 ns, a
+//conversion is SAMC + 12 TAD = 10.8 us, the 3 channel burst 32.4 us of the
+//100 us between bursts. adc_late counts bursts that were not done in time
+#define ADC_PBCLK_HZ 40000000
+#define ADC_ADCS 7
+#define ADC_SAMC 15
+#define ADC_BURST_PINS 3 //HAL_NUM_ADC
+#define ADC_FIRST_WAIT 4000 //loops HAL_Init gives the first burst, it takes 32.4 us
+
+#if ((ADC_SAMC + 12) * 2 * (ADC_ADCS + 1) * ADC_BURST_PINS) >= (ADC_PBCLK_HZ / HAL_ADC_SCAN_HZ)
+#error "an ADC burst does not fit between two HAL_ADC_SCAN_HZ samples"
+#endif
+
+#if (BAT_VOLTAGE_AN > 15) || (BEACON_AN > 15) || (TRACK_WIRE_AN > 15) || (BAT_VOLTAGE_AN == BEACON_AN) \
+        || (BAT_VOLTAGE_AN == TRACK_WIRE_AN) || (BEACON_AN == TRACK_WIRE_AN)
+#error "the analog channels need three different pins of AN0-AN15"
+#endif
+
+static int16_t adc_buf[2][HAL_NUM_ADC][HAL_ADC_BLOCK_LEN];
+static volatile uint32_t adc_scans;
+static uint8_t adc_scanning;
+static uint8_t adc_half; //block being filled
+static uint8_t adc_idx;
+static uint8_t adc_div;
+static uint8_t adc_slot[HAL_NUM_ADC]; //ADC1BUFn of each channel in the burst
+
+//ANx of each channel, from the pin table in robot.h. The numbers follow the
+//Uno32 analog pins (I/O stack V3-V8 on A0-A5, W3-W8 on A6-A11), the ECE118
+//AD library's own table is not in this project, check a new pin on the board
+static const uint8_t adc_an[HAL_NUM_ADC] = {
+    [HAL_BATTERY_ADC] = BAT_VOLTAGE_AN,
+    [HAL_BEACON_ADC] = BEACON_AN,
+    [HAL_TRACK_WIRE_ADC] = TRACK_WIRE_AN,
+};
+static volatile int16_t adc_last[HAL_NUM_ADC]; //latest finished burst
+static volatile uint32_t adc_late; //bursts still converting when the next was due
+
+static volatile uint8_t solenoid_pulses; //left in the train, including the current one
+static volatile uint8_t solenoid_on;
+static volatile uint32_t solenoid_ticks; //left in the current on/off phase
+static uint32_t solenoid_on_ticks;
+static uint32_t solenoid_off_ticks;
+
+//directly based on delay macro from roach.c file given to us by instructors
+
+void HAL_Delay(int loops) {
+    for (int wait = 0; wait < loops; wait++) {
+        asm("nop");
+    }
+}
+
+uint32_t HAL_ReadCycles(void) {
+    return _CP0_GET_COUNT();
+}
+
+uint32_t HAL_DisableInterrupts(void) {
+    return __builtin_disable_interrupts(); //Status before, IE is bit 0
+}
+
+void HAL_RestoreInterrupts(uint32_t status) {
+    if (status & 0x1) {
+        __builtin_enable_interrupts();
+    }
+}
+
+//results of a scan land in ANx order, ADC1BUF0 for the lowest
+
+static uint8_t AdcSlot(uint8_t an, uint32_t list) {
+    return __builtin_popcount(list & ((1u << an) - 1));
+}
+
+static void AdcCollect(void) {
+    volatile uint32_t *buf = &ADC1BUF0; //the ADC1BUFn registers are 16 bytes apart
+
+    adc_last[HAL_BATTERY_ADC] = buf[4 * adc_slot[HAL_BATTERY_ADC]];
+    adc_last[HAL_BEACON_ADC] = buf[4 * adc_slot[HAL_BEACON_ADC]];
+    adc_last[HAL_TRACK_WIRE_ADC] = buf[4 * adc_slot[HAL_TRACK_WIRE_ADC]];
+    IFS1CLR = _IFS1_AD1IF_MASK;
+}
+
+//The AD library scans free running and HAL_ReadAnalog only ever got its latest
+//result, so a sample could be a repeat of the last one or skip one and the
+//rate the beacon Goertzel sees was whatever the library ran at. Instead ADC1
+//is set up here for single bursts, the AD library is not used: CSCNA scans
+//the three pins of adc_an, SSRC auto converts each one after SAMC, and
+//CLRASAM drops ASAM once the third result is in. Timer4 sets ASAM every
+//HAL_ENC_SAMPLE_HZ / HAL_ADC_SCAN_HZ ticks, so every channel is sampled
+//exactly at HAL_ADC_SCAN_HZ, within a burst of each other, and its interrupt
+//collects the finished burst first.
+
+static void AdcStart(void) {
+    uint32_t list = 0;
+    uint32_t wait;
+    uint8_t i;
+
+    for (i = 0; i < HAL_NUM_ADC; i++) {
+        list |= 1u << adc_an[i];
+    }
+    for (i = 0; i < HAL_NUM_ADC; i++) {
+        adc_slot[i] = AdcSlot(adc_an[i], list);
+    }
+
+    AD1CON1 = 0; //off while it is set up
+    TRISBSET = list; //ANx is RBx on the PIC32MX320
+    AD1PCFGCLR = list; //analog
+    AD1CON2 = 0;
+    AD1CON2bits.CSCNA = 1;
+    AD1CON2bits.SMPI = HAL_NUM_ADC - 1; //AD1IF once the burst is done
+    AD1CON3 = 0;
+    AD1CON3bits.SAMC = ADC_SAMC;
+    AD1CON3bits.ADCS = ADC_ADCS;
+    AD1CHS = 0;
+    AD1CSSL = list;
+    AD1CON1bits.SSRC = 7; //auto convert
+    AD1CON1bits.CLRASAM = 1; //stop after one burst
+    IEC1CLR = _IEC1_AD1IE_MASK; //polled from Timer4, no ADC interrupt
+    IFS1CLR = _IFS1_AD1IF_MASK;
+    AD1CON1bits.ON = 1;
+
+    //first burst now, so HAL_ReadAnalog is good before Timer4 runs
+    AD1CON1SET = _AD1CON1_ASAM_MASK;
+    for (wait = 0; (wait < ADC_FIRST_WAIT) && !IFS1bits.AD1IF; wait++) {
+    }
+    AdcCollect();
+}
+
+void HAL_Init(void) {
+    //tape pin setup
+    FRONT_LEFT_TAPE_TRIS = 1;
+    FRONT_RIGHT_TAPE_TRIS = 1;
+    FRONT_CENTER_TAPE_TRIS = 1;
+    BACK_LEFT_TAPE_TRIS = 1;
+    BACK_RIGHT_TAPE_TRIS = 1;
+    SIDE_FRONT_TAPE_TRIS = 1;
+    SIDE_BACK_TAPE_TRIS = 1;
+    //bumper pin setup
+    FRONT_LEFT_BUMPER_TRIS = 1;
+    FRONT_RIGHT_BUMPER_TRIS = 1;
+    BACK_LEFT_BUMPER_TRIS = 1;
+    BACK_RIGHT_BUMPER_TRIS = 1;
+    SIDE_LEFT_BUMPER_TRIS = 1;
+    SIDE_RIGHT_BUMPER_TRIS = 1;
+
+    //motor init
+    PWM_Init();
+    PWM_SetFrequency(1000);
+
+    PWM_AddPins(MTR_A_ENABLE | MTR_B_ENABLE);
+
+    //motor 1
+    //init dir & enc pins
+    MTR_A_IN1_TRIS = 0;
+    MTR_A_IN2_TRIS = 0;
+    MTR_A_ENCA_TRIS = 1;
+    MTR_A_ENCB_TRIS = 1;
+
+    //set initial direction forward
+    MTR_A_IN1_LAT = 1;
+    MTR_A_IN2_LAT = 0;
+
+    //motor2:
+    //init dir & enc pins
+    MTR_B_IN1_TRIS = 0;
+    MTR_B_IN2_TRIS = 0;
+    MTR_B_ENCA_TRIS = 1;
+    MTR_B_ENCB_TRIS = 1;
+
+    //set initial direction forward
+    MTR_B_IN1_LAT = 1;
+    MTR_B_IN2_LAT = 0;
+
+    //solenoid pin
+    SOLENOID_TRIS = 0;
+    SOLENOID_LAT = 0;
+
+    //track wire pin
+    TRACK_WIRE_TRISA = 0;
+    TRACK_WIRE_TRISB = 0;
+
+    //beacon pin
+    BEACON_TRISA = 0; //todo: maybe set A to true at start. Same applies to trackwire
+    BEACON_TRISB = 0;
+    BEACON_TRISC = 0;
+
+    AdcStart();
+}
+
+uint16_t HAL_ReadTape(void) {
+    return ((SIDE_FRONT_TAPE_BIT << 6) | (SIDE_BACK_TAPE_BIT << 5) | (BACK_RIGHT_TAPE_BIT << 4) | (BACK_LEFT_TAPE_BIT << 3) | (FRONT_CENTER_TAPE_BIT << 2) | (FRONT_RIGHT_TAPE_BIT << 1) | FRONT_LEFT_TAPE_BIT);
+}
+
+uint8_t HAL_ReadBumpers(void) {
+    return ((SIDE_FRONT_BUMPER_BIT << 5) | (SIDE_BACK_BUMPER_BIT << 4) | (BACK_RIGHT_BUMPER_BIT << 3) | (BACK_LEFT_BUMPER_BIT << 2) | (FRONT_RIGHT_BUMPER_BIT << 1) | FRONT_LEFT_BUMPER_BIT);
+}
+
+uint8_t HAL_ReadEncoder(HAL_Motor_t motor) {
+    if (HAL_LEFT_MTR == motor) {
+        return (MTR_A_ENCA_BIT << 1) | MTR_A_ENCB_BIT;
+    }
+    return (MTR_B_ENCA_BIT << 1) | MTR_B_ENCB_BIT;
+}
+
+void HAL_SetMotor(HAL_Motor_t motor, uint8_t forward, uint16_t duty) {
+    if (HAL_LEFT_MTR == motor) {
+        MTR_A_IN1_LAT = (forward != 0);
+        MTR_A_IN2_LAT = (forward == 0);
+        PWM_SetDutyCycle(MTR_A_ENABLE, duty);
+    } else {
+        MTR_B_IN1_LAT = (forward != 0);
+        MTR_B_IN2_LAT = (forward == 0);
+        PWM_SetDutyCycle(MTR_B_ENABLE, duty);
+    }
+}
+
+void HAL_SetSolenoid(uint8_t on) {
+    SOLENOID_LAT = (on != 0);
+}
+
+void HAL_SolenoidPulseTrain(uint8_t pulses, uint16_t on_ms, uint16_t off_ms) {
+    IEC0CLR = _IEC0_T4IE_MASK;
+    solenoid_on_ticks = (uint32_t) on_ms * (HAL_ENC_SAMPLE_HZ / 1000) + 1;
+    solenoid_off_ticks = (uint32_t) off_ms * (HAL_ENC_SAMPLE_HZ / 1000) + 1;
+    solenoid_pulses = pulses;
+    solenoid_on = (pulses != 0);
+    solenoid_ticks = solenoid_on_ticks;
+    SOLENOID_LAT = solenoid_on;
+    IEC0SET = _IEC0_T4IE_MASK;
+}
+
+uint8_t HAL_SolenoidBusy(void) {
+    return (solenoid_pulses != 0);
+}
+
+void HAL_SelectBeacon(uint8_t index) {
+    BEACON_LATA = (0 == index);
+    BEACON_LATB = (1 == index);
+    BEACON_LATC = (2 == index);
+}
+
+void HAL_SelectTrackWire(uint8_t index) {
+    TRACK_WIRE_LATA = index;
+    TRACK_WIRE_LATB = !index;
+}
+
+uint16_t HAL_ReadAnalog(HAL_Analog_t channel) {
+    return (channel < HAL_NUM_ADC) ? adc_last[channel] : 0;
+}
+
+void HAL_EncoderStart(HAL_EncoderISRFunc isr) {
+    encoder_isr = isr;
+
+    //Timer4 free running at HAL_ENC_SAMPLE_HZ, 1:1 prescale
+    T4CON = 0;
+    TMR4 = 0;
+    PR4 = BOARD_GetPBClock() / HAL_ENC_SAMPLE_HZ - 1;
+    IPC4bits.T4IP = 5; //above the ES_Timers tick, nothing in here blocks
+    IPC4bits.T4IS = 0;
+    IFS0bits.T4IF = 0;
+    IEC0bits.T4IE = 1;
+    T4CONbits.ON = 1;
+}
+
+void HAL_EncoderIntDisable(void) {
+    IEC0CLR = _IEC0_T4IE_MASK;
+}
+
+void HAL_EncoderIntEnable(void) {
+    IEC0SET = _IEC0_T4IE_MASK;
+}
+
+//The PIC32MX320 has no DMA, the blocks are filled from the Timer4 interrupt
+//as each burst is collected (AdcStart). A block sample is the burst
+//started one scan period before, the delay is the same for every sample.
+
+void HAL_AdcScanStart(void) {
+    IEC0CLR = _IEC0_T4IE_MASK;
+    adc_scans = 0;
+    adc_half = 0;
+    adc_idx = 0;
+    adc_div = 0;
+    adc_scanning = 1;
+    IEC0SET = _IEC0_T4IE_MASK;
+}
+
+uint32_t HAL_AdcScanCount(void) {
+    return adc_scans;
+}
+
+const int16_t *HAL_AdcScanData(HAL_Analog_t channel, uint32_t block) {
+    return adc_buf[block & 1][channel];
+}
+
+void HAL_TickStart(HAL_TickFunc tick) {
+    IEC0CLR = _IEC0_T4IE_MASK;
+    tick_func = tick;
+    tick_div = 0;
+    IEC0SET = _IEC0_T4IE_MASK;
+}
+
+void HAL_TelemetryStart(void) {
+    //UART2 (Uno32 pin 39), 8N1, serial.c keeps UART1
+    U2MODE = 0;
+    U2STA = 0;
+    U2BRG = BOARD_GetPBClock() / (16 * TELEM_BAUD) - 1;
+    U2STAbits.UTXISEL = 0; //interrupt while the TX buffer has room
+    U2STAbits.UTXEN = 1;
+    IPC8bits.U2IP = 2; //below the ES_Timers tick and the encoder interrupt
+    IPC8bits.U2IS = 0;
+    IFS1CLR = _IFS1_U2TXIF_MASK;
+    U2MODEbits.ON = 1;
+}
+
+void HAL_TelemetryKick(void) {
+    IEC1SET = _IEC1_U2TXIE_MASK;
+}
+
+void __ISR(_UART_2_VECTOR, IPL2AUTO) Uart2IntHandler(void) {
+    uint8_t byte;
+
+    //fill the TX buffer, and stop interrupting once the ring is empty
+    while (!U2STAbits.UTXBF) {
+        if (!Telem_NextByte(&byte)) {
+            IEC1CLR = _IEC1_U2TXIE_MASK;
+            break;
+        }
+        U2TXREG = byte;
+    }
+    IFS1CLR = _IFS1_U2TXIF_MASK;
+}
+
+void __ISR(_TIMER_4_VECTOR, IPL5AUTO) Timer4IntHandler(void) {
+    IFS0CLR = _IFS0_T4IF_MASK;
+    encoder_isr();
+
+    if (tick_func && (++tick_div >= (HAL_ENC_SAMPLE_HZ / HAL_TICK_HZ))) {
+        tick_div = 0;
+        tick_func();
+    }
+
+    //solenoid pulse train, the latch is only touched on phase changes
+    if (solenoid_pulses && (0 == --solenoid_ticks)) {
+        if (solenoid_on) {
+            SOLENOID_LAT = 0;
+            solenoid_on = 0;
+            solenoid_ticks = solenoid_off_ticks;
+            solenoid_pulses--;
+        } else {
+            SOLENOID_LAT = 1;
+            solenoid_on = 1;
+            solenoid_ticks = solenoid_on_ticks;
+        }
+    }
+
+    if (++adc_div >= (HAL_ENC_SAMPLE_HZ / HAL_ADC_SCAN_HZ)) {
+        adc_div = 0;
+        if (IFS1bits.AD1IF) {
+            AdcCollect();
+        } else {
+            adc_late++; //still converting, this sample repeats the last burst
+        }
+        AD1CON1SET = _AD1CON1_ASAM_MASK; //next burst
+        if (adc_scanning) {
+            adc_buf[adc_half][HAL_BATTERY_ADC][adc_idx] = HAL_ReadAnalog(HAL_BATTERY_ADC);
+            adc_buf[adc_half][HAL_BEACON_ADC][adc_idx] = HAL_ReadAnalog(HAL_BEACON_ADC);
+            adc_buf[adc_half][HAL_TRACK_WIRE_ADC][adc_idx] = HAL_ReadAnalog(HAL_TRACK_WIRE_ADC);
+            if (++adc_idx >= HAL_ADC_BLOCK_LEN) {
+                adc_idx = 0;
+                adc_half ^= 1;
+            }
+            adc_scans++;
+        }
+    }
+}
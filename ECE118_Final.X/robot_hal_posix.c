@@ -0,0 +1,317 @@
+/*
+ * File:   robot_hal_posix.c
+ *
+ * Host (gcc/POSIX) backend for robot_hal.h, built with ROBOT_HOST defined.
+ * Inputs are plain variables that a simulator or test sets through the
+ * HAL_HostSet* functions, outputs are latched so they can be read back with
+ * HAL_HostGet*. Time is a virtual microsecond clock that only moves when
+ * HAL_HostAdvance is called (see host/ES_Port_Host.c), so a run is fully
+ * deterministic and can go as fast as the host CPU allows.
+ *
+ * Created on October 17, 2026
+ */
+
+
+#include <math.h>
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "robot.h"
+#include "robot_hal.h"
+#include "telemetry.h"
+
+/*** MACROS ***/
+#define HOST_DELAY_LOOPS_PER_US 10 //rough speed of the nop loop at 80MHz
+
+#define HOST_BATTERY_DEFAULT 700 //well above BATTERY_DISCONNECT_THRESHOLD
+
+//the ADC samples on whole microseconds, so the beacon tone only takes this
+//many phases and HostBeaconSample looks them up instead of calling sin()
+#define HOST_TONE_PERIOD_US (1000000 / HAL_BEACON_TONE_HZ)
+#if (1000000 % HAL_BEACON_TONE_HZ) != 0
+#error "HAL_BEACON_TONE_HZ has to divide 1 MHz for the host tone table"
+#endif
+
+/*** Module Variables ***/
+static uint64_t host_micros;
+static HAL_HostStepFunc host_step;
+
+static uint16_t host_tape;
+static uint8_t host_bumpers;
+static uint8_t host_enc[HAL_NUM_MTRS];
+static uint16_t host_battery = HOST_BATTERY_DEFAULT;
+static uint16_t host_beacon[HAL_NUM_BEACONS];
+static uint16_t host_beacon_tone[HAL_NUM_BEACONS];
+static uint16_t host_trackwire[HAL_NUM_TRACK_WIRES];
+
+static HAL_EncoderISRFunc host_encoder_isr;
+static HAL_TickFunc host_tick;
+static uint64_t host_tick_next_us;
+static uint8_t host_encoder_masked;
+static uint8_t host_encoder_pending;
+
+static uint8_t host_solenoid_pulses;
+static uint64_t host_solenoid_next_us; //end of the current on/off phase
+static uint32_t host_solenoid_on_us;
+static uint32_t host_solenoid_off_us;
+
+static int16_t host_adc_buf[2][HAL_NUM_ADC][HAL_ADC_BLOCK_LEN];
+static uint32_t host_adc_scans;
+static uint8_t host_adc_scanning;
+static uint64_t host_adc_next_us;
+static double host_tone_sin[HOST_TONE_PERIOD_US];
+
+static int16_t host_motor[HAL_NUM_MTRS];
+static uint8_t host_solenoid;
+static uint8_t host_beacon_select;
+static uint8_t host_trackwire_select;
+
+static FILE *host_telem;
+
+void HAL_Init(void) {
+    host_motor[HAL_LEFT_MTR] = 0;
+    host_motor[HAL_RIGHT_MTR] = 0;
+    host_solenoid = 0;
+    host_beacon_select = 0;
+    host_trackwire_select = 0;
+}
+
+void HAL_Delay(int loops) {
+    HAL_HostAdvance(loops / HOST_DELAY_LOOPS_PER_US);
+}
+
+//real time, not the virtual clock, this is for measuring the host CPU
+
+uint32_t HAL_ReadCycles(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t) ((uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec);
+}
+
+//the host "interrupts" (encoder, tick, ADC) run inside HAL_HostAdvance, never
+//in the middle of something else
+
+uint32_t HAL_DisableInterrupts(void) {
+    return 0;
+}
+
+void HAL_RestoreInterrupts(uint32_t status) {
+}
+
+uint16_t HAL_ReadTape(void) {
+    return host_tape;
+}
+
+uint8_t HAL_ReadBumpers(void) {
+    return host_bumpers;
+}
+
+uint8_t HAL_ReadEncoder(HAL_Motor_t motor) {
+    return host_enc[motor];
+}
+
+void HAL_SetMotor(HAL_Motor_t motor, uint8_t forward, uint16_t duty) {
+    host_motor[motor] = forward ? (int16_t) duty : -(int16_t) duty;
+}
+
+void HAL_SetSolenoid(uint8_t on) {
+    host_solenoid = (on != 0);
+}
+
+void HAL_SolenoidPulseTrain(uint8_t pulses, uint16_t on_ms, uint16_t off_ms) {
+    host_solenoid_on_us = (uint32_t) on_ms * 1000;
+    host_solenoid_off_us = (uint32_t) off_ms * 1000;
+    host_solenoid_pulses = pulses;
+    host_solenoid = (pulses != 0);
+    host_solenoid_next_us = host_micros + host_solenoid_on_us;
+}
+
+uint8_t HAL_SolenoidBusy(void) {
+    return (host_solenoid_pulses != 0);
+}
+
+void HAL_SelectBeacon(uint8_t index) {
+    host_beacon_select = index;
+}
+
+void HAL_SelectTrackWire(uint8_t index) {
+    host_trackwire_select = index;
+}
+
+uint16_t HAL_ReadAnalog(HAL_Analog_t channel) {
+    switch (channel) {
+        case HAL_BATTERY_ADC:
+            return host_battery;
+        case HAL_BEACON_ADC:
+            return (host_beacon_select < HAL_NUM_BEACONS) ? host_beacon[host_beacon_select] : 0;
+        case HAL_TRACK_WIRE_ADC:
+            return host_trackwire[host_trackwire_select & 0x1];
+        default:
+            return 0;
+    }
+}
+
+void HAL_EncoderStart(HAL_EncoderISRFunc isr) {
+    host_encoder_isr = isr;
+    host_encoder_masked = 0;
+}
+
+void HAL_EncoderIntDisable(void) {
+    host_encoder_masked = 1;
+}
+
+void HAL_EncoderIntEnable(void) {
+    host_encoder_masked = 0;
+    if (host_encoder_pending && host_encoder_isr) {
+        host_encoder_pending = 0;
+        host_encoder_isr();
+    }
+}
+
+void HAL_AdcScanStart(void) {
+    uint16_t i;
+
+    for (i = 0; i < HOST_TONE_PERIOD_US; i++) {
+        host_tone_sin[i] = sin(2.0 * M_PI * i / HOST_TONE_PERIOD_US);
+    }
+    host_adc_scans = 0;
+    host_adc_scanning = 1;
+    host_adc_next_us = host_micros + 1000000 / HAL_ADC_SCAN_HZ;
+}
+
+uint32_t HAL_AdcScanCount(void) {
+    return host_adc_scans;
+}
+
+const int16_t *HAL_AdcScanData(HAL_Analog_t channel, uint32_t block) {
+    return host_adc_buf[block & 1][channel];
+}
+
+//selected detector's reading with its tone added at the sample instant
+static int16_t HostBeaconSample(uint64_t t_us) {
+    uint8_t sel = (host_beacon_select < HAL_NUM_BEACONS) ? host_beacon_select : 0;
+
+    double v = host_beacon[sel] + host_beacon_tone[sel] * host_tone_sin[t_us % HOST_TONE_PERIOD_US];
+
+    return (int16_t) ((v < 0) ? (v - 0.5) : (v + 0.5)); //lround() without the library call
+}
+
+void HAL_TickStart(HAL_TickFunc tick) {
+    host_tick = tick;
+    host_tick_next_us = host_micros + 1000000 / HAL_TICK_HZ;
+}
+
+//frames go straight out to the ROBOT_HOST_TELEM file, if one was given
+void HAL_TelemetryStart(void) {
+    const char *path = getenv("ROBOT_HOST_TELEM");
+
+    if (path) {
+        host_telem = fopen(path, "wb");
+    }
+}
+
+void HAL_TelemetryKick(void) {
+    uint8_t byte;
+
+    while (Telem_NextByte(&byte)) {
+        if (host_telem) {
+            fputc(byte, host_telem);
+        }
+    }
+}
+
+/*** Host only ***/
+
+uint64_t HAL_HostGetMicros(void) {
+    return host_micros;
+}
+
+void HAL_HostAdvance(uint32_t elapsed_us) {
+    host_micros += elapsed_us;
+    while (host_solenoid_pulses && (host_solenoid_next_us <= host_micros)) {
+        if (host_solenoid) {
+            host_solenoid = 0;
+            host_solenoid_pulses--;
+            host_solenoid_next_us += host_solenoid_off_us;
+        } else {
+            host_solenoid = 1;
+            host_solenoid_next_us += host_solenoid_on_us;
+        }
+    }
+    if (host_step) {
+        host_step(elapsed_us);
+    }
+    //after the plant step, so the tick samples the pins as they are now
+    while (host_tick && (host_tick_next_us <= host_micros)) {
+        host_tick();
+        host_tick_next_us += 1000000 / HAL_TICK_HZ;
+    }
+    while (host_adc_scanning && (host_adc_next_us <= host_micros)) {
+        uint8_t half = (host_adc_scans / HAL_ADC_BLOCK_LEN) & 1;
+        uint8_t idx = host_adc_scans % HAL_ADC_BLOCK_LEN;
+
+        host_adc_buf[half][HAL_BATTERY_ADC][idx] = host_battery;
+        host_adc_buf[half][HAL_BEACON_ADC][idx] = HostBeaconSample(host_adc_next_us);
+        host_adc_buf[half][HAL_TRACK_WIRE_ADC][idx] = host_trackwire[host_trackwire_select & 0x1];
+        host_adc_scans++;
+        host_adc_next_us += 1000000 / HAL_ADC_SCAN_HZ;
+    }
+}
+
+void HAL_HostSetStepFunc(HAL_HostStepFunc step) {
+    host_step = step;
+}
+
+void HAL_HostSetTape(uint16_t tape) {
+    host_tape = tape;
+}
+
+void HAL_HostSetBumpers(uint8_t bumpers) {
+    host_bumpers = bumpers;
+}
+
+void HAL_HostSetEncoder(HAL_Motor_t motor, uint8_t phase) {
+    if (host_enc[motor] == (phase & 0x3)) {
+        return;
+    }
+    host_enc[motor] = phase & 0x3;
+
+    //change notification, deferred while masked like a pending interrupt flag
+    if (host_encoder_masked) {
+        host_encoder_pending = 1;
+    } else if (host_encoder_isr) {
+        host_encoder_isr();
+    }
+}
+
+void HAL_HostSetBattery(uint16_t reading) {
+    host_battery = reading;
+}
+
+void HAL_HostSetBeacon(uint8_t index, uint16_t reading) {
+    host_beacon[index] = reading;
+}
+
+void HAL_HostSetBeaconTone(uint8_t index, uint16_t amplitude) {
+    host_beacon_tone[index] = amplitude;
+}
+
+void HAL_HostSetTrackWire(uint8_t index, uint16_t reading) {
+    host_trackwire[index] = reading;
+}
+
+int16_t HAL_HostGetMotor(HAL_Motor_t motor) {
+    return host_motor[motor];
+}
+
+uint8_t HAL_HostGetSolenoid(void) {
+    return host_solenoid;
+}
+
+uint8_t HAL_HostGetBeaconSelect(void) {
+    return host_beacon_select;
+}
+
+uint8_t HAL_HostGetTrackWireSelect(void) {
+    return host_trackwire_select;
+}
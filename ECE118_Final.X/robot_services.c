@@ -6,276 +6,112 @@
  */
 
 
-#include "xc.h"
 #include "robot.h"
-#include "IO_Ports.h"
-#include "pwm.h"
-#include "AD.h"
 #include "stdio.h"
 #include "ES_Framework.h"
 #include "robot_services.h"
+#include "RobotHSM.h"
+#include "queue_stats.h"
+#include "robot_units.h"
+#include "motion_profile.h"
 
 
 //MACROS
-#define BUMPER_TIMER_TICKS 50
-#define TRACK_WIRE_TIMER_TICKS 10 //poll board and switch active sensor every 10 ms, so each track wire sensor is polled every 20 ms
-#define BEACON_SWITCH_TIMER_TICKS 10 
+#define VELOCITY_TIMER_TICKS 10 //velocity loop period
+
+//Private Functions
+static void Motion_Profile(int32_t left_mm, int32_t right_mm, int32_t ticks, uint8_t speed);
+static void Motion_Update(uint32_t now, uint16_t dt_ms);
 
 //Module Variables
 
 //service priority
-static uint8_t TrackWirePriority;
-static uint8_t BeaconPriority;
-static uint8_t BumpPriority;
-static uint8_t ManeuverPriority;
-static uint8_t WaitPriority;
-static uint8_t LostPriority;
-static uint8_t TempPriority;
-
-//track wire
-uint8_t trackwire_A = 0; //0 = not detected, 1 = detected
-uint8_t trackwire_B = 0; //0 = not detected, 1 = detected
-uint8_t * trackwire_active = &trackwire_A; //pointer to currently active track wire detector's variable)
-uint8_t trackwire_A_out = 0; //
-uint8_t trackwire_B_out = 0; //
-uint16_t trackwire_reading;
-
-
-
-
-//Track Wire Service
-//
-//uint8_t InitTrackWireService(uint8_t Priority) {
-//    ES_Event TrackWireEvent;
-//
-//    TrackWirePriority = Priority;
-//
-//    // in here you write your initialization code
-//    // this includes all hardware and software initialization
-//    // that needs to occur.
-//
-//    //set digital switch selector pins to activate trackwire sensor A first
-//    TRACK_WIRE_LATA = 1;
-//    TRACK_WIRE_LATB = 0;
-//
-//    ES_Timer_InitTimer(TRACK_WIRE_SERVICE_TIMER, TRACK_WIRE_TIMER_TICKS);
-//
-//    // post the initial transition event
-//    TrackWireEvent.EventType = ES_INIT;
-//
-//    if (ES_PostToService(TrackWirePriority, TrackWireEvent) == TRUE) {
-//        return TRUE;
-//    } else {
-//
-//        return FALSE;
-//    }
-//}
-//
-//uint8_t PostTrackWireService(ES_Event ThisEvent) {
-//
-//    return ES_PostToService(TrackWirePriority, ThisEvent);
-//}
-//
-//ES_Event RunTrackWireService(ES_Event ThisEvent) {
-//    ES_Event ReturnEvent;
-//    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
-//
-//    static uint8_t last_trackwire_state = 0x000;
-//    ES_EventTyp_t curEvent;
-//
-//    switch (ThisEvent.EventType) {
-//        case ES_INIT:
-//            // No hardware initialization or single time setups, those
-//            // go in the init function above.
-//
-//            // This section is used to reset service for some reason
-//            break;
-//
-//        case ES_TIMERACTIVE:
-//        case ES_TIMERSTOPPED:
-//            break;
-//
-//            //check for change in bumper state and post event if changed
-//        case ES_TIMEOUT:
-//            //read track wire value
-//            trackwire_reading = AD_ReadADPin(TRACK_WIRE_ADC); // read bumpers
-//            //printf("TrackWireVal: %d\n", trackwire_reading);
-//            //update state of trackwire detector 
-//            if (0 == (*trackwire_active)) {
-//                if (trackwire_reading > UPPER_TRACKWIRE_BOUND) {
-//                    *trackwire_active = 1;
-//
-//                    //post event if both track wire sensors are detecting
-//                    if (trackwire_A && trackwire_B) {
-//                        curEvent = TRACK_WIRE_DETECTED;
-//                        ReturnEvent.EventType = curEvent;
-//                        ReturnEvent.EventParam = 0xFF; //does this need to be anything? placeholder
-//                        printf("Trackwire Detected!\n");
-//                        PostTrackWireService(ReturnEvent);
-//                    }
-//                }
-//
-//            } else {
-//                if (trackwire_reading < LOWER_TRACKWIRE_BOUND) {
-//                    //trackwire is considered lost if either sensor stops detecting it
-//                    if (trackwire_A && trackwire_B) {
-//                        curEvent = TRACK_WIRE_LOST;
-//                        ReturnEvent.EventType = curEvent;
-//                        ReturnEvent.EventParam = 0xFF; //does this need to be anything? placeholder
-//                        printf("Trackwire Lost!\n");
-//                        PostTrackWireService(ReturnEvent);
-//                    }
-//
-//                    //update state of active trackwire
-//                    *trackwire_active = 0;
-//
-//
-//                }
-//            }
-//            //switch active pins and pointers
-//            TRACK_WIRE_LATA = (TRACK_WIRE_LATA + 1) % 2;
-//            TRACK_WIRE_LATB = (TRACK_WIRE_LATB + 1) % 2;
-//
-//            //switch pointer
-//            if (trackwire_active == (&trackwire_A)) {
-//                trackwire_active = &trackwire_B;
-//            } else {
-//                trackwire_active = &trackwire_A;
-//
-//            }
-//
-//            ES_Timer_InitTimer(TRACK_WIRE_SERVICE_TIMER, TRACK_WIRE_TIMER_TICKS);
-//
-//
-//
-//#ifndef SIMPLESERVICE_TEST           // keep this as is for test harness
-//            //PostRoachFSM(ReturnEvent);
-//#else
-//            PostTrackWireService(ReturnEvent);
-//#endif   
-//            break;
-//
-//    }
-//    return ReturnEvent;
-//}
-
-
-//Bumper Service
-
-uint8_t InitBumperDebounceService(uint8_t Priority) {
-    ES_Event BumpEvent;
-
-    BumpPriority = Priority;
-
-    // in here you write your initialization code
-    // this includes all hardware and software initialization
-    // that needs to occur.
-
-    ES_Timer_InitTimer(BUMPER_DEBOUNCE_SERVICE_TIMER, BUMPER_TIMER_TICKS);
-
-    // post the initial transition event
-    BumpEvent.EventType = ES_INIT;
-
-    if (ES_PostToService(BumpPriority, BumpEvent) == TRUE) {
+static uint8_t VelocityPriority;
+
+//motion, see Motion_Start
+static uint8_t move_active;
+static uint16_t move_seq; //bumped by every start and cancel, see Motion_IsCurrent
+static int32_t move_left_start;
+static int32_t move_right_start;
+static int32_t move_ticks;
+static uint32_t move_deadline;
+static uint8_t move_profiled;
+static Profile_t move_profile;
+static int32_t move_left_k; //wheel travel ratios of a profiled move, the outer
+static int32_t move_right_k; //wheel's magnitude is move_k_max
+static int32_t move_k_max;
+
+//Timer events, the timers that only mark the end of a maneuver or wait post
+//their event straight to the state machine from the timer response function
+//instead of going through a service of their own. Indexed by timer number,
+//unused entries have no post function.
+
+typedef struct {
+    ES_EventTyp_t event;
+    pPostFunc post;
+} TimerEvent_t;
+
+static const TimerEvent_t TimerEventTable[16] = {
+    [MANEUVER_SERVICE_TIMER] = {MANEUVER_OVER, PostRobotHSM},
+    [WAIT_SERVICE_TIMER] = {WAIT_OVER, PostRobotHSM},
+    [LOST_SERVICE_TIMER] = {LOST_OVER, PostRobotHSM},
+    [TEMP_SERVICE_TIMER] = {TEMP_OVER, PostRobotHSM},
+};
+
+uint8_t PostTimerEvent(ES_Event ThisEvent) {
+    const TimerEvent_t *entry;
+    ES_Event TimerEvent;
+
+    //ES_TIMERACTIVE/ES_TIMERSTOPPED notifications are not needed
+    if ((ES_TIMEOUT != ThisEvent.EventType) || (ThisEvent.EventParam >= 16)) {
         return TRUE;
-    } else {
+    }
+    entry = &TimerEventTable[ThisEvent.EventParam];
+    if (NULL == entry->post) {
         return FALSE;
     }
+    TimerEvent.EventType = entry->event;
+    TimerEvent.EventParam = 0;
+    return entry->post(TimerEvent);
 }
 
-uint8_t PostBumperDebounceService(ES_Event ThisEvent) {
-    return ES_PostToService(BumpPriority, ThisEvent);
-}
-
-ES_Event RunBumperDebounceService(ES_Event ThisEvent) {
-    ES_Event ReturnEvent;
-    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
-
-    static uint8_t last_bumper_state = 0x000;
-    ES_EventTyp_t curEvent;
-    uint8_t bumper_state = Robot_ReadBumpers(); // read bumpers
-
-    switch (ThisEvent.EventType) {
-        case ES_INIT:
-            // No hardware initialization or single time setups, those
-            // go in the init function above.
-
-            // This section is used to reset service for some reason
-            break;
-
-        case ES_TIMERACTIVE:
-            break;
-        case ES_TIMERSTOPPED:
-            break;
-
-            //check for change in bumper state and post event if changed
-        case ES_TIMEOUT:
-            ES_Timer_InitTimer(BUMPER_DEBOUNCE_SERVICE_TIMER, BUMPER_TIMER_TICKS);
-            if (bumper_state != last_bumper_state) {
-                curEvent = BUMPERS_CHANGED;
-                ReturnEvent.EventType = curEvent;
-                ReturnEvent.EventParam = bumper_state;
-                last_bumper_state = bumper_state; // update history
-                printf("BUMPER_CHANGED: 0x%X\n", bumper_state);
-
-#ifndef SIMPLESERVICE_TEST           // keep this as is for test harness
-                PostRobotHSM(ReturnEvent);
-#else
-                PostBumperDebounceService(ReturnEvent);
-#endif   
-            }
-            break;
-#ifdef SIMPLESERVICE_TEST     // keep this as is for test harness      
-        default:
-            printf("\r\nEvent: %s\tParam: 0x%X",
-                    EventNames[ThisEvent.EventType], ThisEvent.EventParam);
-            break;
-#endif
-    }
-
-    return ReturnEvent;
-}
 
 
-//Maneuver Timer
+//Velocity Service, runs the wheel velocity loops and odometry in robot.c at a fixed rate
 
-uint8_t InitManeuverService(uint8_t Priority) {
-    ES_Event ManeuverEvent;
+uint8_t InitVelocityService(uint8_t Priority) {
+    ES_Event VelocityEvent;
 
-    ManeuverPriority = Priority;
+    VelocityPriority = Priority;
 
-    // in here you write your initialization code
-    // this includes all hardware and software initialization
-    // that needs to occur.
+    ES_Timer_InitTimer(VELOCITY_SERVICE_TIMER, VELOCITY_TIMER_TICKS);
 
     // post the initial transition event
-    ManeuverEvent.EventType = ES_INIT;
+    VelocityEvent.EventType = ES_INIT;
 
-    if (ES_PostToService(ManeuverPriority, ManeuverEvent) == TRUE) {
+    if (QStat_Post(VelocityPriority, VelocityEvent) == TRUE) {
         return TRUE;
     } else {
         return FALSE;
     }
 }
 
-uint8_t PostManeuverService(ES_Event ThisEvent) {
-    return ES_PostToService(ManeuverPriority, ThisEvent);
+uint8_t PostVelocityService(ES_Event ThisEvent) {
+    return QStat_Post(VelocityPriority, ThisEvent);
 }
 
-ES_Event RunManeuverService(ES_Event ThisEvent) {
+ES_Event RunVelocityService(ES_Event ThisEvent) {
     ES_Event ReturnEvent;
     ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
 
-    ES_EventTyp_t curEvent;
+    static uint32_t last_time = 0;
+    uint32_t now;
 
+    QStat_Dequeued(VelocityPriority); //ES_Run took ThisEvent off our queue
 
-    //post LeftTurnOver event
     switch (ThisEvent.EventType) {
         case ES_INIT:
-            // No hardware initialization or single time setups, those
-            // go in the init function above.
-
-            // This section is used to reset service for some reason
+            last_time = ES_Timer_GetTime();
             break;
 
         case ES_TIMERACTIVE:
@@ -283,194 +119,148 @@ ES_Event RunManeuverService(ES_Event ThisEvent) {
         case ES_TIMERSTOPPED:
             break;
 
-            //check for change in bumper state and post event if changed
+            //restart first so the period does not stretch by the loop time,
+            //then use the measured dt in case the timeout was serviced late
         case ES_TIMEOUT:
-            curEvent = MANEUVER_OVER;
-            ReturnEvent.EventType = curEvent;
-            ReturnEvent.EventParam = 0; //todo: do we need this to be anything?
-#ifndef SIMPLESERVICE_TEST           // keep this as is for test harness
-            PostRobotHSM(ReturnEvent);
-#else
-            PostBumperDebounceService(ReturnEvent);
-#endif   
-    }
-    return ReturnEvent;
-}
-
-uint8_t InitWaitService(uint8_t Priority) {
-    ES_Event WaitEvent;
-
-    WaitPriority = Priority;
-
-    // in here you write your initialization code
-    // this includes all hardware and software initialization
-    // that needs to occur.
-
-    // post the initial transition event
-    WaitEvent.EventType = ES_INIT;
-
-    if (ES_PostToService(WaitPriority, WaitEvent) == TRUE) {
-        return TRUE;
-    } else {
-        return FALSE;
-    }
-}
-
-uint8_t PostWaitService(ES_Event ThisEvent) {
-    return ES_PostToService(WaitPriority, ThisEvent);
-}
-
-ES_Event RunWaitService(ES_Event ThisEvent) {
-    ES_Event ReturnEvent;
-    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
-
-    ES_EventTyp_t curEvent;
-
-
-    //post LeftTurnOver event
-    switch (ThisEvent.EventType) {
-        case ES_INIT:
-            // No hardware initialization or single time setups, those
-            // go in the init function above.
-
-            // This section is used to reset service for some reason
+            ES_Timer_InitTimer(VELOCITY_SERVICE_TIMER, VELOCITY_TIMER_TICKS);
+            now = ES_Timer_GetTime();
+            Motion_Update(now, now - last_time);
+            Robot_VelocityUpdate(now - last_time);
+            Robot_OdometryUpdate();
+            last_time = now;
             break;
 
-        case ES_TIMERACTIVE:
-            break;
-        case ES_TIMERSTOPPED:
+        default:
             break;
-
-            //check for change in bumper state and post event if changed
-        case ES_TIMEOUT:
-            curEvent = WAIT_OVER;
-            ReturnEvent.EventType = curEvent;
-            ReturnEvent.EventParam = 0; //todo: do we need this to be anything?
-#ifndef SIMPLESERVICE_TEST           // keep this as is for test harness
-            PostRobotHSM(ReturnEvent);
-#else
-            PostBumperDebounceService(ReturnEvent);
-#endif   
     }
     return ReturnEvent;
 }
 
 
+//Motion, maneuvers that end on encoder distance instead of a timer
 
-uint8_t InitLostService(uint8_t Priority) {
-    ES_Event LostEvent;
-
-    LostPriority = Priority;
-
-    // in here you write your initialization code
-    // this includes all hardware and software initialization
-    // that needs to occur.
-
-    // post the initial transition event
-    LostEvent.EventType = ES_INIT;
-
-    if (ES_PostToService(LostPriority, LostEvent) == TRUE) {
-        return TRUE;
-    } else {
-        return FALSE;
-    }
+void Motion_Start(int32_t ticks, uint16_t timeout_ms) {
+    move_left_start = Robot_GetLeftEncTicks();
+    move_right_start = Robot_GetRightEncTicks();
+    move_ticks = ticks;
+    move_deadline = ES_Timer_GetTime() + timeout_ms;
+    move_profiled = FALSE;
+    move_active = TRUE;
+    move_seq++;
 }
 
-uint8_t PostLostService(ES_Event ThisEvent) {
-    return ES_PostToService(LostPriority, ThisEvent);
-}
+void Motion_Straight(int32_t mm, uint8_t speed) {
+    int32_t k = (mm < 0) ? -1 : 1;
 
-ES_Event RunLostService(ES_Event ThisEvent) {
-    ES_Event ReturnEvent;
-    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
-
-    ES_EventTyp_t curEvent;
-
-
-    //post LeftTurnOver event
-    switch (ThisEvent.EventType) {
-        case ES_INIT:
-            // No hardware initialization or single time setups, those
-            // go in the init function above.
-
-            // This section is used to reset service for some reason
-            break;
-
-        case ES_TIMERACTIVE:
-            break;
-        case ES_TIMERSTOPPED:
-            break;
-
-            //check for change in bumper state and post event if changed
-        case ES_TIMEOUT:
-            curEvent = LOST_OVER;
-            ReturnEvent.EventType = curEvent;
-            ReturnEvent.EventParam = 0; //todo: do we need this to be anything?
-#ifndef SIMPLESERVICE_TEST           // keep this as is for test harness
-            PostRobotHSM(ReturnEvent);
-#else
-            //PostBumperDebounceService(ReturnEvent);
-#endif   
-    }
-    return ReturnEvent;
+    Motion_Profile(k, k, Units_MMToTicks(mm * k), speed);
 }
 
+void Motion_Turn(int32_t deg, uint8_t speed) {
+    int32_t k = (deg < 0) ? -(WHEEL_TRACK_MM / 2) : (WHEEL_TRACK_MM / 2);
 
+    Motion_Profile(-k, k, Units_TurnDegToTicks((deg < 0) ? -deg : deg), speed);
+}
 
-uint8_t InitTempService(uint8_t Priority) {
-    ES_Event TempEvent;
-
-    TempPriority = Priority;
-
-    // in here you write your initialization code
-    // this includes all hardware and software initialization
-    // that needs to occur.
-
-    // post the initial transition event
-    TempEvent.EventType = ES_INIT;
+void Motion_Arc(int32_t radius_mm, int32_t deg, uint8_t speed) {
+    int32_t inner = radius_mm - WHEEL_TRACK_MM / 2; //negative if the center is between the wheels
+    int32_t outer = radius_mm + WHEEL_TRACK_MM / 2;
 
-    if (ES_PostToService(TempPriority, TempEvent) == TRUE) {
-        return TRUE;
+    if (deg < 0) {
+        deg = -deg;
+        Motion_Profile(outer, inner, Units_MMToTicks(outer * deg * 71 / 4068), speed); //71 / 4068 ~ pi / 180
     } else {
-        return FALSE;
+        Motion_Profile(inner, outer, Units_MMToTicks(outer * deg * 71 / 4068), speed);
     }
 }
 
-uint8_t PostTempService(ES_Event ThisEvent) {
-    return ES_PostToService(TempPriority, ThisEvent);
+void Motion_Cancel(void) {
+    move_active = FALSE;
+    move_seq++;
 }
 
-ES_Event RunTempService(ES_Event ThisEvent) {
-    ES_Event ReturnEvent;
-    ReturnEvent.EventType = ES_NO_EVENT; // assume no errors
-
-    ES_EventTyp_t curEvent;
-
-
-    //post LeftTurnOver event
-    switch (ThisEvent.EventType) {
-        case ES_INIT:
-            // No hardware initialization or single time setups, those
-            // go in the init function above.
+uint8_t Motion_IsCurrent(uint16_t param) {
+    return (param >> 1) == (move_seq & MOVE_SEQ_MASK);
+}
 
-            // This section is used to reset service for some reason
-            break;
+uint8_t Motion_Busy(void) {
+    return move_active;
+}
 
-        case ES_TIMERACTIVE:
-            break;
-        case ES_TIMERSTOPPED:
-            break;
+//starts a profiled move of ticks on the outer wheel, with the wheels
+//travelling left_mm : right_mm
+static void Motion_Profile(int32_t left_mm, int32_t right_mm, int32_t ticks, uint8_t speed) {
+    Profile_Limits_t lim;
+    int32_t k_sq;
+
+    move_left_k = left_mm;
+    move_right_k = right_mm;
+    move_k_max = (left_mm < 0) ? -left_mm : left_mm;
+    if (move_k_max < ((right_mm < 0) ? -right_mm : right_mm)) {
+        move_k_max = (right_mm < 0) ? -right_mm : right_mm;
+    }
+    k_sq = left_mm * left_mm + right_mm * right_mm;
+
+    lim.vmax = (int32_t) speed * ROBOT_MAX_WHEEL_TICKS_S / MAX_MTR_SPEED;
+    lim.vmin = MOTION_MIN_TICKS_S;
+    lim.accel = MOTION_ACCEL_TICKS_S2;
+    lim.jerk = MOTION_JERK_TICKS_S3;
+    //start from the speed the wheels already have along the move
+    Profile_Init(&move_profile, ticks, ((int64_t) Robot_GetLeftWheelVelocity() * left_mm
+            + (int64_t) Robot_GetRightWheelVelocity() * right_mm) * move_k_max / k_sq, &lim);
+
+    move_left_start = Robot_GetLeftEncTicks();
+    move_right_start = Robot_GetRightEncTicks();
+    move_ticks = ticks;
+    move_deadline = ES_Timer_GetTime() + 2 * Profile_MinTimeMs(ticks, &lim);
+    move_profiled = TRUE;
+    move_active = TRUE;
+    move_seq++;
+}
 
-            //check for change in bumper state and post event if changed
-        case ES_TIMEOUT:
-            curEvent = TEMP_OVER;
-            ReturnEvent.EventType = curEvent;
-            ReturnEvent.EventParam = 0; //todo: do we need this to be anything?
-#ifndef SIMPLESERVICE_TEST           // keep this as is for test harness
-            PostRobotHSM(ReturnEvent);
-#else
-            //PostBumperDebounceService(ReturnEvent);
-#endif   
+//called with the velocity loop, so a move ends within VELOCITY_TIMER_TICKS of
+//its distance. Profiled moves get their next setpoint here, before
+//Robot_VelocityUpdate runs the loops on it
+static void Motion_Update(uint32_t now, uint16_t dt_ms) {
+    int32_t left;
+    int32_t right;
+    int32_t v;
+    ES_Event MoveEvent;
+
+    if (!move_active) {
+        return;
     }
-    return ReturnEvent;
+    left = Robot_GetLeftEncTicks() - move_left_start;
+    right = Robot_GetRightEncTicks() - move_right_start;
+    if (move_profiled) {
+        //travel along the move, measured on the outer wheel
+        v = Profile_Step(&move_profile, ((int64_t) left * move_left_k + (int64_t) right * move_right_k) * move_k_max
+                / (move_left_k * move_left_k + move_right_k * move_right_k), dt_ms);
+        if (Profile_Done(&move_profile)) {
+            MoveEvent.EventParam = MOVE_REACHED;
+        } else if ((int32_t) (now - move_deadline) >= 0) {
+            MoveEvent.EventParam = MOVE_TIMED_OUT;
+        } else {
+            Robot_SetWheelVelocity(v * move_left_k / move_k_max, v * move_right_k / move_k_max);
+            return;
+        }
+        Robot_SetWheelVelocity(0, 0);
+    } else {
+        if (left < 0) {
+            left = -left;
+        }
+        if (right < 0) {
+            right = -right;
+        }
+        if ((left + right) >= 2 * move_ticks) {
+            MoveEvent.EventParam = MOVE_REACHED;
+        } else if ((int32_t) (now - move_deadline) >= 0) {
+            MoveEvent.EventParam = MOVE_TIMED_OUT;
+        } else {
+            return;
+        }
+    }
+    move_active = FALSE;
+    MoveEvent.EventType = MOVE_COMPLETE;
+    MoveEvent.EventParam |= (move_seq & MOVE_SEQ_MASK) << 1;
+    PostRobotHSM(MoveEvent);
 }
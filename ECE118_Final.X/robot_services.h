@@ -13,13 +13,6 @@
 
 
 
-//bumpers
-uint8_t InitBumperDebounceService(uint8_t Priority);
-uint8_t PostBumperDebounceService(ES_Event ThisEvent);
-ES_Event RunBumperDebounceService(ES_Event ThisEvent);
-
-
-
 //track wire detector
 //uint8_t InitTrackWireService(uint8_t Priority);
 //uint8_t PostTrackWireService(ES_Event ThisEvent);
@@ -30,27 +23,44 @@ ES_Event RunBumperDebounceService(ES_Event ThisEvent);
 //uint8_t PostBeaconService(ES_Event ThisEvent);
 //ES_Event RunBeaconService(ES_Event ThisEvent);
 
-//maneuver timer
-uint8_t InitManeuverService(uint8_t Priority); //Handles maneuver timer
-uint8_t PostManeuverService(ES_Event ThisEvent); //Handles maneuver timer
-ES_Event RunManeuverService(ES_Event ThisEvent); //Handles maneuver timer
-
-
-//wait timer
-uint8_t InitWaitService(uint8_t Priority);
-uint8_t PostWaitService(ES_Event ThisEvent); 
-ES_Event RunWaitService(ES_Event ThisEvent); 
-
-
-//lost timer
-uint8_t InitLostService(uint8_t Priority); 
-uint8_t PostLostService(ES_Event ThisEvent); 
-ES_Event RunLostService(ES_Event ThisEvent); 
-
-
-//temp timer
-uint8_t InitTempService(uint8_t Priority); 
-uint8_t PostTempService(ES_Event ThisEvent); 
-ES_Event RunTempService(ES_Event ThisEvent); 
+//maneuver, wait, lost and temp timers: TIMERn_RESP_FUNC for timers that just
+//turn ES_TIMEOUT into an event for a state machine, see TimerEventTable
+uint8_t PostTimerEvent(ES_Event ThisEvent);
+
+
+//velocity loop, fixed rate PI on the encoder counts (see Robot_SetWheelVelocity)
+uint8_t InitVelocityService(uint8_t Priority);
+uint8_t PostVelocityService(ES_Event ThisEvent);
+ES_Event RunVelocityService(ES_Event ThisEvent);
+
+//encoder distance maneuvers, checked by VelocityService. Motion_Start watches
+//whatever the wheels were last told to do and posts MOVE_COMPLETE to RobotHSM
+//once both wheels average ticks of travel (either direction, so it covers
+//spins too), or timeout_ms after the start if they never get there. The
+//wheels are left running, the machine sets the next speed on the event.
+#define MOVE_REACHED 0 //MOVE_COMPLETE params, MOVE_RESULT of the param
+#define MOVE_TIMED_OUT 1
+#define MOVE_RESULT(param) ((param) & 1) //the rest is the move's sequence number
+#define MOVE_SEQ_MASK 0x7FFF
+
+void Motion_Start(int32_t ticks, uint16_t timeout_ms);
+
+//profiled moves, VelocityService drives the wheels through a jerk limited
+//trapezoid (motion_profile.h) up to speed (0-100, like the MtrSpeed functions)
+//and brings them to a stop on the distance, then posts MOVE_COMPLETE the same
+//way. Positive deg turns left (counterclockwise), arcs are about a center
+//radius_mm from the middle of the robot, on the side the robot turns to. A
+//move times out after twice its planned time.
+void Motion_Straight(int32_t mm, uint8_t speed); //negative mm backs up
+void Motion_Turn(int32_t deg, uint8_t speed); //spin in place
+void Motion_Arc(int32_t radius_mm, int32_t deg, uint8_t speed);
+void Motion_Cancel(void); //either kind, the wheels keep their last setpoint
+uint8_t Motion_Busy(void);
+
+//A state that starts a move in its ES_ENTRY cancels it in its ES_EXIT, but
+//the move may have finished with MOVE_COMPLETE still in the queue. FALSE for
+//the param of such an event, or of any move since replaced by a newer one.
+//RunRobotHSM drops those before they reach a state.
+uint8_t Motion_IsCurrent(uint16_t param);
 
 #endif
\ No newline at end of file
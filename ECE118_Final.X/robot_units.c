@@ -0,0 +1,140 @@
+/*
+ * File:   robot_units.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include "robot_units.h"
+
+#define UNITS_ROUND ((int64_t) 1 << (UNITS_Q - 1))
+
+static int32_t Units_Scale(int32_t x, int32_t k_q24) {
+    return (int32_t) (((int64_t) x * k_q24 + UNITS_ROUND) >> UNITS_Q);
+}
+
+int32_t Units_TicksToMM(int32_t ticks) {
+    return Units_Scale(ticks, UNITS_MM_PER_TICK_Q24);
+}
+
+int32_t Units_TicksTo100thIn(int32_t ticks) {
+    return Units_Scale(ticks, UNITS_100TH_IN_PER_TICK_Q24);
+}
+
+int32_t Units_TicksToDeg(int32_t ticks) {
+    return Units_Scale(ticks, UNITS_DEG_PER_TICK_Q24);
+}
+
+int32_t Units_MMToTicks(int32_t mm) {
+    return Units_Scale(mm, UNITS_TICKS_PER_MM_Q24);
+}
+
+int32_t Units_TurnDegToTicks(int32_t deg) {
+    return Units_Scale(deg, UNITS_TICKS_PER_TURN_DEG_Q24);
+}
+
+/*
+ * Host test harness, checks the conversions against exact double math over
+ * +-2^24 ticks and times them against the old double versions from
+ * robot.c (Robot_GetLeftEnc_MM before the switch to this module):
+ *
+ *   gcc -O2 -DUNITS_TEST -o units_test robot_units.c -lm
+ *
+ * The host has an FPU, so the gap there is much smaller than on the PIC32
+ * where the double expression becomes several soft float library calls.
+ */
+#ifdef UNITS_TEST
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_NOW() __rdtsc()
+#define BENCH_UNIT "cycles"
+#else
+#define BENCH_NOW() BenchNanos()
+#define BENCH_UNIT "ns"
+
+static uint64_t BenchNanos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+#endif
+
+#define TEST_TICKS_PER_REV 1632
+#define TEST_DIAM_MM 62
+#define TEST_TRACK_MM 230
+#define TEST_RANGE (1L << 24) //ticks, about 8 km of travel
+#define BENCH_N 1000000
+
+//the old robot.c conversions, kept verbatim (including the 2 * 3.14)
+static int16_t OldEncMM(int32_t count) {
+    return (int16_t) (count * 2 * 3.14 * TEST_DIAM_MM / TEST_TICKS_PER_REV);
+}
+
+static int16_t OldEncDeg(int32_t count) {
+    return (int16_t) (count * 360 / TEST_TICKS_PER_REV);
+}
+
+static int CheckRange(const char *name, int32_t(*f)(int32_t), double per_tick, int32_t max_in) {
+    int32_t x;
+    double worst = 0;
+    int32_t step = max_in / 100003 + 1;
+
+    for (x = -max_in; x <= max_in - step; x += step) {
+        double err = fabs(f(x) - x * per_tick);
+        if (err > worst) {
+            worst = err;
+        }
+    }
+    printf("%-16s |x| <= %8d  worst error %.3f%s\n", name, max_in, worst, (worst <= 1.0) ? "" : "   <-- FAIL");
+    return (worst <= 1.0);
+}
+
+static volatile int32_t bench_in[256];
+static volatile int32_t bench_sink;
+
+static double Bench16(int16_t(*f)(int32_t)) {
+    uint64_t t0 = BENCH_NOW();
+    int i;
+    for (i = 0; i < BENCH_N; i++) {
+        bench_sink = f(bench_in[i & 0xff]);
+    }
+    return (double) (BENCH_NOW() - t0) / BENCH_N;
+}
+
+static double Bench32(int32_t(*f)(int32_t)) {
+    uint64_t t0 = BENCH_NOW();
+    int i;
+    for (i = 0; i < BENCH_N; i++) {
+        bench_sink = f(bench_in[i & 0xff]);
+    }
+    return (double) (BENCH_NOW() - t0) / BENCH_N;
+}
+
+int main(void) {
+    double mm_per_tick = M_PI * TEST_DIAM_MM / TEST_TICKS_PER_REV;
+    int ok = 1;
+    int i;
+
+    ok &= CheckRange("TicksToMM", Units_TicksToMM, mm_per_tick, TEST_RANGE);
+    ok &= CheckRange("TicksTo100thIn", Units_TicksTo100thIn, mm_per_tick / 25.4 * 100, TEST_RANGE);
+    ok &= CheckRange("TicksToDeg", Units_TicksToDeg, 360.0 / TEST_TICKS_PER_REV, TEST_RANGE);
+    ok &= CheckRange("MMToTicks", Units_MMToTicks, 1 / mm_per_tick, TEST_RANGE / 2);
+    ok &= CheckRange("TurnDegToTicks", Units_TurnDegToTicks, M_PI * TEST_TRACK_MM / 360 / mm_per_tick, TEST_RANGE / 32);
+
+    //one wheel turn, and 18 m of travel where the old (doubled) int16 result is out of range
+    printf("1632 ticks: old %d mm, new %d mm (exact %.1f)\n", OldEncMM(1632), Units_TicksToMM(1632), 1632 * mm_per_tick);
+    printf("150000 ticks: old %d mm, new %d mm (exact %.1f)\n", OldEncMM(150000), Units_TicksToMM(150000), 150000 * mm_per_tick);
+
+    for (i = 0; i < 256; i++) {
+        bench_in[i] = (i * 7919) - 1000000;
+    }
+    Bench32(Units_TicksToMM); //warm up
+    printf("per call (%s): old mm %.1f, new mm %.1f, old deg %.1f, new deg %.1f\n", BENCH_UNIT,
+            Bench16(OldEncMM), Bench32(Units_TicksToMM), Bench16(OldEncDeg), Bench32(Units_TicksToDeg));
+
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
+#endif
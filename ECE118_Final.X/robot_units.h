@@ -0,0 +1,49 @@
+/*
+ * File:   robot_units.h
+ *
+ * Encoder tick to distance/angle conversions without floating point (the
+ * PIC32MX has no FPU, so every double op is a software library call). Each
+ * conversion is one 32x32->64 multiply by a precomputed Q24 constant and a
+ * shift, results are 32 bit so they don't wrap for the length of a match.
+ * Pure functions, build with UNITS_TEST defined for the host test and
+ * benchmark at the bottom of robot_units.c.
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef ROBOT_UNITS_H
+#define	ROBOT_UNITS_H
+
+#include <stdint.h>
+
+/*** MACROS ***/
+#define UNITS_Q 24 //fraction bits of the constants below
+
+//ENC_TICKS_PER_REV, WHEEL_DIAM_MM and WHEEL_TRACK_MM of robot.h, repeated so
+//this module builds on its own, robot.c stops the build if they differ
+#define UNITS_TICKS_PER_REV 1632
+#define UNITS_WHEEL_DIAM_MM 62
+#define UNITS_WHEEL_TRACK_MM 230
+#define UNITS_PI 3.14159265358979323846
+
+//rounds a positive double constant expression to Q24, the compiler folds it
+//to an integer so no floating point is left in the code
+#define UNITS_CONST_Q24(x) ((int32_t) ((x) * (1L << UNITS_Q) + 0.5))
+
+#define UNITS_MM_PER_TICK_Q24 UNITS_CONST_Q24(UNITS_PI * UNITS_WHEEL_DIAM_MM / UNITS_TICKS_PER_REV)
+#define UNITS_100TH_IN_PER_TICK_Q24 UNITS_CONST_Q24(UNITS_PI * UNITS_WHEEL_DIAM_MM / 25.4 * 100 / UNITS_TICKS_PER_REV)
+#define UNITS_DEG_PER_TICK_Q24 UNITS_CONST_Q24(360.0 / UNITS_TICKS_PER_REV)
+#define UNITS_TICKS_PER_MM_Q24 UNITS_CONST_Q24(UNITS_TICKS_PER_REV / (UNITS_PI * UNITS_WHEEL_DIAM_MM))
+#define UNITS_TICKS_PER_TURN_DEG_Q24 UNITS_CONST_Q24(1.0 * UNITS_WHEEL_TRACK_MM * UNITS_TICKS_PER_REV / (360 * UNITS_WHEEL_DIAM_MM))
+
+/*** Function Headers ***/
+
+//all within 1 count of the exact value for |input| up to 2^24 (about 8 km of
+//travel), the Q24 rounding of the constant is what limits it
+int32_t Units_TicksToMM(int32_t ticks); //wheel travel in mm
+int32_t Units_TicksTo100thIn(int32_t ticks); //wheel travel in 1/100 inch
+int32_t Units_TicksToDeg(int32_t ticks); //wheel rotation in degrees, not wrapped
+int32_t Units_MMToTicks(int32_t mm); //ticks for a wheel travel in mm
+int32_t Units_TurnDegToTicks(int32_t deg); //ticks each wheel turns for a spin in place of deg
+
+#endif	/* ROBOT_UNITS_H */
@@ -0,0 +1,154 @@
+/*
+ * File:   tape_filter.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include "tape_filter.h"
+
+/*** MACROS ***/
+#if (TAPE_FILTER_M < 1) || (TAPE_FILTER_M > 8)
+#error "TAPE_FILTER_M has to be 1 to 8, the window of a sensor is one byte"
+#endif
+#if (TAPE_FILTER_N * 2 <= TAPE_FILTER_M) || (TAPE_FILTER_N > TAPE_FILTER_M)
+#error "TAPE_FILTER_N has to be more than half of TAPE_FILTER_M and at most TAPE_FILTER_M"
+#endif
+
+#define TAPE_FILTER_WINDOW ((1 << TAPE_FILTER_M) - 1)
+#define TAPE_FILTER_BITS ((1 << TAPE_FILTER_SENSORS) - 1)
+
+/*** Public Functions ***/
+
+void TapeFilter_Init(TapeFilter_t *f, uint16_t tape) {
+    uint8_t i;
+
+    tape &= TAPE_FILTER_BITS;
+    for (i = 0; i < TAPE_FILTER_SENSORS; i++) {
+        f->hist[i] = ((tape >> i) & 1) ? TAPE_FILTER_WINDOW : 0;
+    }
+    f->state = tape;
+    f->raw_prev = tape;
+    f->raw_edges = 0;
+    f->edges = 0;
+}
+
+uint16_t TapeFilter_Sample(TapeFilter_t *f, uint16_t raw) {
+    uint16_t old_state = f->state;
+    uint8_t i;
+
+    raw &= TAPE_FILTER_BITS;
+    for (i = 0; i < TAPE_FILTER_SENSORS; i++) {
+        uint8_t h = ((f->hist[i] << 1) | ((raw >> i) & 1)) & TAPE_FILTER_WINDOW;
+        uint8_t ones = __builtin_popcount(h);
+
+        f->hist[i] = h;
+        if (ones >= TAPE_FILTER_N) {
+            f->state |= (1 << i);
+        } else if (ones <= (TAPE_FILTER_M - TAPE_FILTER_N)) {
+            f->state &= ~(1 << i);
+        } //in between, hold
+    }
+    f->raw_edges += __builtin_popcount(raw ^ f->raw_prev);
+    f->edges += __builtin_popcount(f->state ^ old_state);
+    f->raw_prev = raw;
+    return f->state;
+}
+
+uint32_t TapeFilter_Suppressed(const TapeFilter_t *f) {
+    return f->raw_edges - f->edges;
+}
+
+/*
+ * Host test, runs recorded single sensor bitstreams (one character per 1 ms
+ * sample, as CheckTape feeds the filter) through bit 0 of the filter and
+ * checks that every real crossing comes out as exactly one edge, that every
+ * output edge is backed by N of the last M samples and that the output ends
+ * where the stream does:
+ *
+ *   gcc -O2 -DTAPE_FILTER_TEST -o tape_filter_test tape_filter.c
+ *
+ * The "sim" streams were recorded from the host build with
+ * ROBOT_SIM_TAPE_EDGE_MM=2 and 4 (ArenaSim.h), where a sensor that close to a
+ * tape edge reads at random; the sim holds a reading for its 2 ms physics step.
+ */
+#ifdef TAPE_FILTER_TEST
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    const char *name;
+    const char *bits;
+    uint8_t edges; //crossings the filter has to pass, no more and no less
+} TapeStream_t;
+
+static const TapeStream_t Streams[] = {
+    {"clean on/off", "000000000011111111111111111111000000000000", 2},
+    {"1 ms spikes", "000100000100000001000000000100000000000000", 0},
+    {"1 ms dropouts", "111111011111110111111111011111111111111111", 0},
+    {"short on pulse", "000000000000111000000000000000000000000000", 0},
+    {"bouncy entry", "000001010011011101111111111111111111111111", 1},
+    {"bouncy exit", "111111111101111011001010010000000000000000", 1},
+    {"sim entry", "0000000011111111001100111111111", 1},
+    {"sim exit", "11111111001111001111000000000", 1},
+    {"sim slow exit", "1111111100111111110011111100111111000000000", 1},
+    {"sim slow entry", "000000001100001100111100111111110011111100111111111", 1},
+    {"sim slow exit 2", "111111110011110000000000110000110011000000000", 1},
+    {"sim slow entry 2", "00000000110000000011001100000011000000111100111111111", 1},
+    {"sim slow exit 3", "111111110011001111110011001111001100001100110011000011000000000", 1},
+    {"sim graze", "000000001100110011000011000000000", 0},
+    {"sim graze 2", "11111111001100111111111", 0},
+    //riding along the edge, the 4 ms runs in the middle are let through
+    {"sim along edge", "0000000011001111001111001100001100110011000000111111111", 3},
+};
+
+#define NUM_STREAMS (sizeof (Streams) / sizeof (Streams[0]))
+
+int main(void) {
+    uint32_t total_raw = 0;
+    uint32_t total_suppressed = 0;
+    uint8_t fail = 0;
+    uint8_t i;
+
+    printf("tape filter %d of %d, sensor 0\n", TAPE_FILTER_N, TAPE_FILTER_M);
+    printf("%-16s %4s %5s %5s %10s\n", "stream", "ms", "raw", "out", "suppressed");
+    for (i = 0; i < NUM_STREAMS; i++) {
+        const TapeStream_t *st = &Streams[i];
+        TapeFilter_t f;
+        uint16_t len = strlen(st->bits);
+        uint16_t n;
+        uint8_t out;
+        uint8_t prev_out;
+        uint8_t bad = 0;
+
+        TapeFilter_Init(&f, st->bits[0] - '0');
+        prev_out = f.state & 1;
+        for (n = 0; n < len; n++) {
+            out = TapeFilter_Sample(&f, st->bits[n] - '0') & 1;
+            if (out != prev_out) {
+                //the output may only follow a run of N samples at its new value
+                uint8_t agree = 0;
+                uint8_t k;
+                for (k = 0; (k < TAPE_FILTER_M) && (k <= n); k++) {
+                    agree += ((st->bits[n - k] - '0') == out);
+                }
+                if (agree < TAPE_FILTER_N) {
+                    bad = 1;
+                }
+                prev_out = out;
+            }
+        }
+        //and has to end where the stream ends
+        if ((f.edges != st->edges) || (out != (st->bits[len - 1] - '0'))) {
+            bad = 1;
+        }
+        printf("%-16s %4u %5u %5u %10u %s\n", st->name, len, (unsigned) f.raw_edges, (unsigned) f.edges,
+                (unsigned) TapeFilter_Suppressed(&f), bad ? "FAIL" : "");
+        total_raw += f.raw_edges;
+        total_suppressed += TapeFilter_Suppressed(&f);
+        fail |= bad;
+    }
+    printf("suppressed %u of %u raw edges\n", (unsigned) total_suppressed, (unsigned) total_raw);
+    printf("%s\n", fail ? "FAIL" : "PASS");
+    return fail;
+}
+#endif
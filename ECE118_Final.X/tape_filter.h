@@ -0,0 +1,42 @@
+/*
+ * File:   tape_filter.h
+ *
+ * Per sensor N-of-M glitch filter for the tape sensors. Each sensor keeps its
+ * last TAPE_FILTER_M samples; its output goes on once TAPE_FILTER_N of them
+ * read on and off once TAPE_FILTER_N of them read off. With N above M/2 the
+ * two thresholds do not overlap, so a sensor sitting on a tape edge holds its
+ * last state instead of chattering, and a spike shorter than M - N + 1
+ * samples never gets through.
+ *
+ * CheckTape feeds it one sample per ms, so the window is TAPE_FILTER_M ms and
+ * a clean edge is passed on TAPE_FILTER_N ms after it happens. Build with
+ * TAPE_FILTER_TEST defined for the host test at the bottom of tape_filter.c.
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef TAPE_FILTER_H
+#define	TAPE_FILTER_H
+
+#include <stdint.h>
+
+/*** Macros ***/
+#define TAPE_FILTER_SENSORS 7 //*_TAPE_MASK bits 0 to 6
+#define TAPE_FILTER_M 5 //window in samples, 1 to 8
+#define TAPE_FILTER_N 4 //agreeing samples needed to change, M/2 + 1 to M
+
+/*** Typedefs ***/
+typedef struct {
+    uint8_t hist[TAPE_FILTER_SENSORS]; //bit 0 is the newest sample
+    uint16_t state; //filtered *_TAPE_MASK bits
+    uint16_t raw_prev;
+    uint32_t raw_edges; //bit changes seen going in
+    uint32_t edges; //bit changes let through
+} TapeFilter_t;
+
+/*** Function Headers ***/
+void TapeFilter_Init(TapeFilter_t *f, uint16_t tape); //fills the window with tape
+uint16_t TapeFilter_Sample(TapeFilter_t *f, uint16_t raw); //returns the filtered bits
+uint32_t TapeFilter_Suppressed(const TapeFilter_t *f); //raw edges that never got through
+
+#endif	/* TAPE_FILTER_H */
@@ -0,0 +1,39 @@
+/*
+ * File:   telem_trace.h
+ *
+ * ES_Tattle() as a telemetry frame (telemetry.h). A state machine file
+ * defines TELEM_SOURCE and includes this after ES_Framework.h. With
+ * USE_TELEMETRY (ES_Configure.h) it replaces the framework's ES_Tattle() and
+ * ES_Tail() for that file only, without it the TattleTale ones are left alone.
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef TELEM_TRACE_H
+#define	TELEM_TRACE_H
+
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "telemetry.h"
+
+#ifdef USE_TELEMETRY
+
+#ifdef SUPPRESS_EXIT_ENTRY_IN_TATTLE
+#define TELEM_TRACED(type) (((type) != ES_ENTRY) && ((type) != ES_EXIT))
+#else
+#define TELEM_TRACED(type) TRUE
+#endif
+
+#undef ES_Tattle
+#undef ES_Tail
+#define ES_Tattle() do { \
+    (void) StateNames; /* the frame carries the number, the names are for TattleTale */ \
+    if (TELEM_TRACED(ThisEvent.EventType)) { \
+        Telem_Frame(TELEM_SOURCE, ThisEvent.EventType, ThisEvent.EventParam, CurrentState); \
+    } \
+} while (0)
+#define ES_Tail()
+
+#endif
+
+#endif	/* TELEM_TRACE_H */
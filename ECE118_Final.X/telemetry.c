@@ -0,0 +1,75 @@
+/*
+ * File:   telemetry.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include "ES_Configure.h"
+#include "ES_Timers.h"
+#include "BOARD.h"
+#include "robot_hal.h"
+#include "telemetry.h"
+
+/*** MACROS ***/
+#define TELEM_RING_SIZE 256 //uint8_t indexes wrap on their own
+
+/*** Module Variables ***/
+static uint8_t ring[TELEM_RING_SIZE];
+static volatile uint8_t head; //next byte written, only Telem_Frame moves it
+static volatile uint8_t tail; //next byte sent, only Telem_NextByte moves it
+static uint32_t dropped;
+
+/*** Public Functions ***/
+
+#ifdef USE_TELEMETRY
+
+void Telem_Init(void) {
+    head = 0;
+    tail = 0;
+    dropped = 0;
+    HAL_TelemetryStart();
+}
+
+void Telem_Frame(uint8_t source, uint8_t type, uint16_t param, uint8_t state) {
+    uint32_t now = ES_Timer_GetTime();
+    uint8_t h = head;
+    uint8_t sum;
+
+    //one slot is kept empty so a full ring does not look empty
+    if ((uint8_t) (tail - h - 1) < TELEM_FRAME_LEN) {
+        dropped++;
+        return;
+    }
+    ring[h++] = TELEM_SYNC;
+    ring[h++] = now;
+    ring[h++] = now >> 8;
+    ring[h++] = now >> 16;
+    ring[h++] = now >> 24;
+    ring[h++] = source;
+    ring[h++] = type;
+    ring[h++] = param;
+    ring[h++] = param >> 8;
+    ring[h++] = state;
+    sum = (now & 0xFF) + ((now >> 8) & 0xFF) + ((now >> 16) & 0xFF) + (now >> 24)
+            + source + type + (param & 0xFF) + (param >> 8) + state;
+    ring[h++] = sum;
+    head = h; //the whole frame becomes visible to the drain at once
+    HAL_TelemetryKick();
+}
+
+#endif
+
+uint8_t Telem_NextByte(uint8_t *byte) {
+    uint8_t t = tail;
+
+    if (t == head) {
+        return FALSE;
+    }
+    *byte = ring[t];
+    tail = t + 1;
+    return TRUE;
+}
+
+uint32_t Telem_Dropped(void) {
+    return dropped;
+}
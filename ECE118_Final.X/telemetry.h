@@ -0,0 +1,82 @@
+/*
+ * File:   telemetry.h
+ *
+ * Binary debug stream. Telem_Frame packs a fixed size frame into a 256 byte
+ * ring and returns, the bytes go out on their own: UART2 TX interrupt on the
+ * PIC32 (the PIC32MX320 has no DMA, UART1 stays with serial.c and printf),
+ * a file named by ROBOT_HOST_TELEM on the host. host/telem_decode turns a
+ * capture back into text or CSV.
+ *
+ * Frame, TELEM_FRAME_LEN bytes, multi byte fields little endian:
+ *
+ *   0     TELEM_SYNC
+ *   1-4   time, ES_Timer_GetTime() ms
+ *   5     source, TELEM_SOURCES below
+ *   6     type, ES_EventTyp_t for state machine sources, Telem_Code_t for Robot
+ *   7-8   param
+ *   9     state, CurrentState of the source (motor for Robot)
+ *   10    checksum, sum of bytes 1 to 9
+ *
+ * Without USE_TELEMETRY (ES_Configure.h) Telem_Init and Telem_Frame compile
+ * to nothing. With it ES_Tattle() also writes a frame per event into a state
+ * machine instead of building the TattleTale text trace, see telem_trace.h.
+ *
+ * Frames are written from the main loop only, there is one producer and the
+ * TX interrupt is the one consumer, so the ring needs no locking. A frame that
+ * does not fit is dropped whole and counted.
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef TELEMETRY_H
+#define	TELEMETRY_H
+
+#include <stdint.h>
+#include "ES_Configure.h"
+
+/*** Macros ***/
+#define TELEM_SYNC 0xA5
+#define TELEM_FRAME_LEN 11
+#define TELEM_BAUD 115200
+
+#define TELEM_SOURCES(X) \
+    X(Robot) \
+    X(RobotHSM) \
+    X(TowardsTowerSubHSM) \
+    X(AtTowerSubHSM) \
+    X(TapeSubState) \
+    X(OnTapeSubHSM) \
+    X(TraverseSubHSM) \
+    X(TowerAlignSubHSM) \
+    X(TowerTraverseSubHSM) \
+    X(TowerShootSubHSM) \
+    X(TemplateHSM)
+
+/*** Typedefs ***/
+#define TELEM_SRC_ENUM(name) TELEM_SRC_##name,
+
+typedef enum {
+    TELEM_SOURCES(TELEM_SRC_ENUM)
+    TELEM_NUM_SOURCES,
+} Telem_Source_t;
+
+typedef enum {
+    TELEM_MTR_RANGE, //Robot_*MtrSpeed out of bounds, param is the speed
+    TELEM_TW_BAND, //track wire band moved (trackwire_cal.h), param is the lower bound with the
+                   //sensor in bit 15, state the width up to the upper bound (255 at most)
+    TELEM_NUM_CODES,
+} Telem_Code_t;
+
+/*** Function Headers ***/
+#ifdef USE_TELEMETRY
+void Telem_Init(void); //starts the HAL side (HAL_TelemetryStart)
+void Telem_Frame(uint8_t source, uint8_t type, uint16_t param, uint8_t state);
+#else
+//UART2 is never started and nothing is framed, the ring stays empty
+#define Telem_Init()
+#define Telem_Frame(source, type, param, state)
+#endif
+uint8_t Telem_NextByte(uint8_t *byte); //for the HAL drain, FALSE when the ring is empty
+uint32_t Telem_Dropped(void); //frames that did not fit
+
+#endif	/* TELEMETRY_H */
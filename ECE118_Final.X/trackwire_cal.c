@@ -0,0 +1,273 @@
+/*
+ * File:   trackwire_cal.c
+ *
+ * Created on October 17, 2026
+ */
+
+#include "trackwire_cal.h"
+
+/*** Private Functions ***/
+
+static void TrackWireCal_SetBand(TrackWireCal_Sensor_t *s) {
+    int32_t rise = TW_CAL_LOWER_NOISE * s->noise / 256;
+    int32_t hyst = TW_CAL_HYST_NOISE * s->noise / 256;
+    int32_t lower;
+    int32_t mad = s->noise >> 4; //counts * 16
+
+    if (rise < TW_CAL_MIN_RISE) {
+        rise = TW_CAL_MIN_RISE;
+    }
+    if (hyst < TW_CAL_MIN_HYST) {
+        hyst = TW_CAL_MIN_HYST;
+    }
+    lower = s->base / 256 + rise;
+    if (lower + hyst > TW_CAL_MAX_UPPER) {
+        lower = TW_CAL_MAX_UPPER - hyst;
+    }
+    s->lower = lower;
+    s->upper = lower + hyst;
+
+    //sigma^2 = 25/16 * (mad / 16)^2, in two shifts so mad^2 stays in 32 bits
+    if (mad < TW_CAL_MIN_NOISE * 16) {
+        mad = TW_CAL_MIN_NOISE * 16;
+    }
+    s->bound = TW_CAL_LOG_ODDS * 25 * ((mad * mad) >> 8) / (16 * hyst);
+}
+
+/*** Public Functions ***/
+
+void TrackWireCal_Init(TrackWireCal_t *c) {
+    uint8_t i;
+
+    for (i = 0; i < TW_CAL_SENSORS; i++) {
+        c->sensor[i].base = 0;
+        c->sensor[i].noise = 0;
+        c->sensor[i].sum = 0;
+        c->sensor[i].bound = 0;
+        c->sensor[i].lower = 0;
+        c->sensor[i].upper = 0;
+        c->sensor[i].blocks = 0;
+        c->sensor[i].tested = 0;
+        c->sensor[i].on = 0;
+        c->decided[i] = 0;
+    }
+    c->select = 0;
+    c->found = 0;
+}
+
+uint8_t TrackWireCal_Sample(TrackWireCal_t *c, uint8_t sensor, uint16_t reading) {
+    TrackWireCal_Sensor_t *s = &c->sensor[sensor];
+    int32_t x = (int32_t) reading * 256;
+    int32_t dev;
+
+    if (s->blocks < TW_CAL_STARTUP_BLOCKS) {
+        //running mean of the startup readings, the deviation is from the mean
+        //so far so the first few count a little low
+        s->blocks++;
+        s->base += (x - s->base) / s->blocks;
+        dev = (x > s->base) ? x - s->base : s->base - x;
+        s->noise += (dev - s->noise) / s->blocks;
+        if (TW_CAL_STARTUP_BLOCKS == s->blocks) {
+            TrackWireCal_SetBand(s);
+        }
+        return 1; //the start is away from the tower, whatever it reads
+    } else if (!s->on && (2 * reading < s->base / 256 + s->lower)) {
+        dev = (x > s->base) ? x - s->base : s->base - x;
+        s->base += (x - s->base) >> TW_CAL_BASE_SHIFT;
+        s->noise += (dev - s->noise) >> TW_CAL_NOISE_SHIFT;
+        TrackWireCal_SetBand(s);
+    }
+
+    s->sum += (int32_t) reading - (s->on ? s->lower : s->upper);
+    s->tested++;
+    if (s->sum > s->bound) {
+        s->on = 1;
+    } else if (s->sum < -s->bound) {
+        s->on = 0;
+    } else if (s->tested < TW_CAL_MAX_BLOCKS) {
+        return 0;
+    } else {
+        s->on = (s->sum > 0) || (s->on && (0 == s->sum)); //out of readings, the mean decides
+    }
+    s->sum = 0;
+    s->tested = 0;
+    return 1;
+}
+
+uint8_t TrackWireCal_Block(TrackWireCal_t *c, uint16_t reading, uint32_t block) {
+    uint8_t sensor = c->select;
+    uint8_t other = !sensor;
+    uint8_t found;
+
+    if (!TrackWireCal_Sample(c, sensor, reading)) {
+        return 0;
+    }
+    c->decided[sensor] = block;
+    found = c->sensor[sensor].on && c->sensor[other].on && (block - c->decided[other] <= TW_CAL_FRESH_BLOCKS);
+
+    //an off sensor is all it takes to say the wire is not found, so it stays
+    //selected until it comes on, then the other one is (re)checked
+    if (found || c->found || c->sensor[sensor].on || !TrackWireCal_Ready(c, other)) {
+        c->select = other;
+    }
+    if (found != c->found) {
+        c->found = found;
+        return 1;
+    }
+    return 0;
+}
+
+uint8_t TrackWireCal_Ready(const TrackWireCal_t *c, uint8_t sensor) {
+    return c->sensor[sensor].blocks >= TW_CAL_STARTUP_BLOCKS;
+}
+
+void TrackWireCal_GetBand(const TrackWireCal_t *c, uint8_t sensor, uint16_t *lower, uint16_t *upper) {
+    *lower = c->sensor[sensor].lower;
+    *upper = c->sensor[sensor].upper;
+}
+
+/*
+ * Host test, feeds synthetic readings of one sensor through the calibration
+ * and the sequential test, and through the old fixed 540/580 band:
+ *
+ *   gcc -O2 -DTRACKWIRE_CAL_TEST -o trackwire_cal_test trackwire_cal.c
+ *
+ * Each case is a quiet floor (drifting linearly from base to base_end over
+ * the run) with uniform noise of +-noise counts, and a number of passes by
+ * the wire where the reading ramps up by rise over ramp readings, holds, and
+ * ramps back down. The calibrated band has to turn on exactly once in every
+ * pass and never while the wire is out of range. The fixed band is only
+ * reported, the cases with the floor moved are the ones it gets wrong.
+ */
+#ifdef TRACKWIRE_CAL_TEST
+#include <stdio.h>
+
+#define TEST_QUIET 120 //readings between passes
+#define TEST_HOLD 30 //readings at full rise
+#define TEST_PASSES 12
+#define TEST_FIXED_LOWER 540 //the band the calibration replaced
+#define TEST_FIXED_UPPER 580
+
+typedef struct {
+    const char *name;
+    int16_t base;
+    int16_t base_end;
+    int16_t noise;
+    int16_t rise;
+    uint8_t ramp;
+} TrackWireCase_t;
+
+static const TrackWireCase_t Cases[] = {
+    {"nominal", 420, 420, 12, 220, 4}, //ArenaSim levels, SIM_ADC_NOISE
+    {"weak field", 300, 300, 12, 180, 4}, //coil turned away, never reaches 580
+    {"high floor", 600, 600, 12, 220, 4}, //over 580 with no wire at all
+    {"battery drift", 480, 400, 12, 200, 4},
+    {"drift up", 400, 470, 12, 200, 4},
+    {"noisy", 420, 420, 60, 300, 4},
+    {"slow approach", 420, 420, 12, 200, 40},
+};
+
+#define NUM_CASES (sizeof (Cases) / sizeof (Cases[0]))
+
+static uint32_t rand_state;
+
+static int16_t TestNoise(int16_t amplitude) {
+    rand_state = rand_state * 1103515245 + 12345;
+    return (int16_t) ((rand_state >> 16) % (2 * amplitude + 1)) - amplitude;
+}
+
+typedef struct {
+    uint8_t on;
+    uint16_t found; //passes it turned on in
+    uint16_t extra; //second and later turn ons in one pass
+    uint16_t false_on; //turn ons with the wire out of range
+    uint8_t on_this_pass;
+} TestCount_t;
+
+static void Count(TestCount_t *t, uint8_t on, uint8_t wire) {
+    if (on && !t->on) {
+        if (!wire) {
+            t->false_on++;
+        } else if (t->on_this_pass) {
+            t->extra++;
+        } else {
+            t->on_this_pass = 1;
+            t->found++;
+        }
+    }
+    t->on = on;
+}
+
+//returns the number of failures of the calibrated band
+static int RunCase(const TrackWireCase_t *c) {
+    TrackWireCal_t cal;
+    TestCount_t got = {0};
+    TestCount_t fixed = {0};
+    uint16_t pass_len = 2 * c->ramp + TEST_HOLD;
+    uint16_t cycle = TEST_QUIET + pass_len;
+    uint32_t total = (uint32_t) cycle * TEST_PASSES + TEST_QUIET;
+    uint32_t i;
+    uint16_t lower;
+    uint16_t upper;
+    int bad;
+
+    rand_state = 1;
+    TrackWireCal_Init(&cal);
+    for (i = 0; i < total; i++) {
+        uint16_t at = i % cycle;
+        int32_t floor = c->base + (int32_t) (c->base_end - c->base) * (int32_t) i / (int32_t) total;
+        int32_t level = 0;
+        uint8_t wire = 0;
+        int32_t reading;
+
+        if ((i < (uint32_t) cycle * TEST_PASSES) && (at >= TEST_QUIET)) {
+            at -= TEST_QUIET;
+            if (at < c->ramp) {
+                level = (int32_t) c->rise * (at + 1) / (c->ramp + 1);
+            } else if (at < c->ramp + TEST_HOLD) {
+                level = c->rise;
+            } else {
+                level = (int32_t) c->rise * (pass_len - at) / (c->ramp + 1);
+            }
+            wire = 1; //the ramps count as the wire being in range
+        } else {
+            got.on_this_pass = 0;
+            fixed.on_this_pass = 0;
+        }
+        reading = floor + level + TestNoise(c->noise);
+        if (reading < 0) {
+            reading = 0;
+        } else if (reading > 1023) {
+            reading = 1023;
+        }
+        TrackWireCal_Sample(&cal, 0, reading);
+        Count(&got, cal.sensor[0].on, wire);
+        if (!fixed.on && (reading > TEST_FIXED_UPPER)) {
+            Count(&fixed, 1, wire);
+        } else if (fixed.on && (reading < TEST_FIXED_LOWER)) {
+            Count(&fixed, 0, wire);
+        }
+    }
+    TrackWireCal_GetBand(&cal, 0, &lower, &upper);
+
+    bad = (got.found != TEST_PASSES) + (got.extra != 0) + (got.false_on != 0);
+    printf("%-14s %4d %4d %4d %4d %5.1f %5u %5u %4u/%-3u %2u %2u %4u/%-3u %2u %2u %s\n", c->name, c->base, c->base_end,
+            c->noise, c->rise, cal.sensor[0].noise / 256.0, lower, upper, got.found, TEST_PASSES, got.extra,
+            got.false_on, fixed.found, TEST_PASSES, fixed.extra, fixed.false_on, bad ? "<-- FAIL" : "");
+    return bad;
+}
+
+int main(void) {
+    int bad = 0;
+    uint8_t i;
+
+    printf("%u passes per case, found/passes, extra turn ons in a pass, turn ons with no wire\n", TEST_PASSES);
+    printf("%-14s %4s %4s %4s %4s %5s %5s %5s %8s %2s %2s %8s %2s %2s\n", "case", "base", "end", "+-", "rise",
+            "noise", "lower", "upper", "found", "ex", "fa", "fixed", "ex", "fa");
+    for (i = 0; i < NUM_CASES; i++) {
+        bad += RunCase(&Cases[i]);
+    }
+    printf("%s\n", bad ? "FAIL" : "PASS");
+    return bad ? 1 : 0;
+}
+#endif
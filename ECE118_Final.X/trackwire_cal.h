@@ -0,0 +1,98 @@
+/*
+ * File:   trackwire_cal.h
+ *
+ * Self calibrating detection band for the track wire sensors. Each sensor
+ * keeps a baseline (its reading with no wire in range) and a noise floor (the
+ * mean absolute deviation of its readings from the baseline), and its band
+ * sits on top of them:
+ *
+ *   lower = baseline + max(TW_CAL_MIN_RISE, TW_CAL_LOWER_NOISE * noise)
+ *   upper = lower + max(TW_CAL_MIN_HYST, TW_CAL_HYST_NOISE * noise)
+ *
+ * A reading is the mean of one scan block (HAL_ADC_BLOCK_LEN samples, 2.5 ms).
+ * The first TW_CAL_STARTUP_BLOCKS readings of a sensor are averaged into its
+ * baseline and noise, so the robot has to start away from the tower, and the
+ * sensor reads off until they are in. After that a reading in the lower half
+ * of the gap to the band moves the baseline by 1/2^TW_CAL_BASE_SHIFT of the
+ * difference and the noise floor by 1/2^TW_CAL_NOISE_SHIFT, anything higher
+ * could be the wire coming into range and is not learned from.
+ *
+ * Whether a sensor is on is decided by a sequential probability ratio test
+ * instead of a fixed number of readings. An off sensor tests "mean at upper -
+ * d" against "mean at upper + d", an on sensor the same around lower, with 2d
+ * the width of the band. For readings with gaussian noise of sigma the log
+ * likelihood ratio is 2d / sigma^2 times the sum of (reading - upper), so the
+ * sum is kept in counts and the test ends when it is past
+ *
+ *   +-bound = TW_CAL_LOG_ODDS * sigma^2 / 2d, sigma = 5/4 * noise
+ *
+ * A reading far from the band decides on its own, one near it is followed by
+ * more until the evidence is in, up to TW_CAL_MAX_BLOCKS where the sign of
+ * the sum decides. The noise is taken as independent from block to block,
+ * which interference slower than a block is not, the band being several noise
+ * floors over the baseline is what keeps that from false triggering.
+ *
+ * TrackWireCal_Block runs the pair of sensors on one ADC channel: the wire is
+ * found when both are on, and since an off sensor is enough to say it is not,
+ * that sensor is kept selected until it comes on instead of switching every
+ * reading. The other sensor counts as on only if it was decided within
+ * TW_CAL_FRESH_BLOCKS. Build with TRACKWIRE_CAL_TEST defined for the host test
+ * at the bottom of trackwire_cal.c, host/trackwire_bench.c runs recorded sim
+ * traces through it.
+ *
+ * Created on October 17, 2026
+ */
+
+#ifndef TRACKWIRE_CAL_H
+#define	TRACKWIRE_CAL_H
+
+#include <stdint.h>
+
+/*** Macros ***/
+#define TW_CAL_SENSORS 2
+#define TW_CAL_STARTUP_BLOCKS 16 //readings per sensor averaged before the band is set, ~0.4 s alternating
+#define TW_CAL_BASE_SHIFT 8 //baseline time constant, 256 readings (0.6 s watching one sensor, ~4 s alternating)
+#define TW_CAL_NOISE_SHIFT 8
+#define TW_CAL_LOWER_NOISE 4 //lower bound in noise floors over the baseline (of one block, the
+                             //old 6 and 3 were of a 2 block reading with 1/sqrt(2) the noise)
+#define TW_CAL_MIN_RISE 60 //ADC counts, keeps a quiet sensor from tripping on drift
+#define TW_CAL_HYST_NOISE 2
+#define TW_CAL_MIN_HYST 40 //same width as the old fixed band
+#define TW_CAL_MAX_UPPER 1000 //a band pushed up to the top of the 10 bit ADC still trips
+#define TW_CAL_LOG_ODDS 7 //ln((1 - b) / a) for a = b = 0.001 false/missed decisions
+#define TW_CAL_MIN_NOISE 2 //ADC counts, noise the test assumes at least (quantization)
+#define TW_CAL_MAX_BLOCKS 8 //readings before the test is cut short, the old average was 2
+#define TW_CAL_FRESH_BLOCKS 20 //scan blocks (50 ms) a decision of the other sensor counts for
+
+/*** Typedefs ***/
+typedef struct {
+    int32_t base; //ADC counts * 256
+    int32_t noise; //ADC counts * 256
+    int32_t sum; //sequential test, readings minus the threshold, ADC counts
+    int32_t bound; //the test decides once the sum is past +-bound
+    uint16_t lower; //0 until calibrated
+    uint16_t upper;
+    uint8_t blocks; //startup readings so far, TW_CAL_STARTUP_BLOCKS when calibrated
+    uint8_t tested; //readings in the sequential test so far
+    uint8_t on;
+} TrackWireCal_Sensor_t;
+
+typedef struct {
+    TrackWireCal_Sensor_t sensor[TW_CAL_SENSORS];
+    uint32_t decided[TW_CAL_SENSORS]; //scan block of each sensor's last decision
+    uint8_t select; //sensor the next reading has to come from
+    uint8_t found; //both sensors on
+} TrackWireCal_t;
+
+/*** Function Headers ***/
+void TrackWireCal_Init(TrackWireCal_t *c); //same as all zero
+//runs one reading through the sensor's test, returns TRUE when it came to a
+//decision, the sensor's on/off is in sensor[].on
+uint8_t TrackWireCal_Sample(TrackWireCal_t *c, uint8_t sensor, uint16_t reading);
+//one reading of the selected sensor from scan block number block, returns
+//TRUE when found changed. Switch to c->select before the next reading
+uint8_t TrackWireCal_Block(TrackWireCal_t *c, uint16_t reading, uint32_t block);
+uint8_t TrackWireCal_Ready(const TrackWireCal_t *c, uint8_t sensor); //startup readings are in
+void TrackWireCal_GetBand(const TrackWireCal_t *c, uint8_t sensor, uint16_t *lower, uint16_t *upper);
+
+#endif	/* TRACKWIRE_CAL_H */